@@ -38,6 +38,11 @@
 #define FINGER_PRESENT          0x01
 
 #define POLL_INTERVAL_MS        50
+
+/* Model file, overridden by FP_FOCALTECH_MODEL; compiled-in weights otherwise */
+#ifndef FT_NN_MODEL_PATH
+#define FT_NN_MODEL_PATH        "/usr/share/libfprint/focaltech0752.ftnn"
+#endif
 #define NR_ENROLL_STAGES        15
 
 /* Commands */
@@ -56,8 +61,9 @@ struct _FpiDeviceFocaltech0752
   gsize           raw_buffer_len;
   guint           poll_timeout_id;
 
-  /* Matcher context */
+  /* Matcher context and its preallocated buffers */
   FtNNMatchContext match_ctx;
+  FtNNEngine     *engine;
 
   /* Enrollment state */
   FtNNTemplate   *enroll_templates;
@@ -68,6 +74,9 @@ struct _FpiDeviceFocaltech0752
   FtNNTemplate   *verify_templates;
   int             verify_count;
 
+  /* Identification: the capture, matched against every enrolled print */
+  FtNNProbe       identify_probe;
+
   /* Debug tracking */
   gchar          *debug_dir;
   guint64         debug_session_id;
@@ -207,19 +216,45 @@ capture_read_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GE
   memcpy (self->raw_buffer + self->raw_buffer_len, transfer->buffer, copy_len);
   self->raw_buffer_len += copy_len;
 
+  /*
+   * Request the rest before preprocessing, so the device sends it meanwhile.
+   * The transfer reads into a buffer of its own and raw_buffer only changes
+   * in this callback, so feeding it below cannot race the read.
+   */
+  if (self->raw_buffer_len < RAW_IMAGE_SIZE)
+    {
+      FpiUsbTransfer *read_transfer = fpi_usb_transfer_new (dev);
+      fpi_usb_transfer_fill_bulk (read_transfer, EP_IN, RAW_IMAGE_SIZE);
+      fpi_usb_transfer_submit (read_transfer, 5000, NULL, capture_read_cb, NULL);
+    }
+
+  /* Preprocess the rows that have arrived while the rest is in flight */
+  ft_nn_process_feed (self->engine, self->raw_buffer, self->raw_buffer_len);
+
   /* Check if complete */
   if (self->raw_buffer_len >= RAW_IMAGE_SIZE)
     {
       fp_info ("Fingerprint captured - processing...");
 
-      /* Process raw data to normalized float image */
+      /* Finish the normalized float image */
       float image[FT_NN_INPUT_SIZE];
-      ft_nn_process_raw (self->raw_buffer, image);
+      ft_nn_process_finish (self->engine, self->raw_buffer, image);
 
       /* Quality check */
-      if (!ft_nn_check_quality (image))
+      FtNNQualityReport quality;
+      guint64 quality_ns = 0;
+      gboolean quality_ok = ft_nn_assess_quality (self->engine, image, &quality);
+
+      for (gint stage = 0; stage < FT_NN_QUALITY_N_STAGES; stage++)
+        quality_ns += quality.stage_ns[stage];
+      fp_dbg ("Quality: contrast=%.3f variance=%.4f std=%.3f center=%.3f gabor=%.4f%s coherence=%.3f time=%luus",
+              quality.contrast, quality.variance, quality.std, quality.center_ratio,
+              quality.gabor, quality.gabor_dense ? "" : "~", quality.coherence,
+              (unsigned long) (quality_ns / 1000));
+
+      if (!quality_ok)
         {
-          fp_dbg ("Image quality check failed");
+          fp_dbg ("Image quality check failed at stage %d", quality.failed_stage);
           FpiDeviceAction action = fpi_device_get_current_action (dev);
 
           if (action == FPI_DEVICE_ACTION_ENROLL)
@@ -240,7 +275,6 @@ capture_read_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GE
 
           /* Continue polling */
           self->finger_on_sensor = FALSE;
-          g_clear_pointer (&self->raw_buffer, g_free);
           self->raw_buffer_len = 0;
           start_finger_detection (self);
           return;
@@ -252,13 +286,13 @@ capture_read_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GE
       if (action == FPI_DEVICE_ACTION_ENROLL)
         {
           /* Create template */
-          if (!ft_nn_create_template (image, &self->enroll_templates[self->enroll_count]))
+          if (!ft_nn_create_template (self->engine, image,
+                                      &self->enroll_templates[self->enroll_count]))
             {
               fp_dbg ("Failed to create template");
               fpi_device_enroll_progress (dev, self->enroll_stage, NULL,
                 fpi_device_retry_new (FP_DEVICE_RETRY_GENERAL));
               self->finger_on_sensor = FALSE;
-              g_clear_pointer (&self->raw_buffer, g_free);
               self->raw_buffer_len = 0;
               start_finger_detection (self);
               return;
@@ -339,15 +373,16 @@ capture_read_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GE
           /* Match using 5-stage pipeline */
           gint64 t_match_start = g_get_monotonic_time ();
           FtNNMatchResult result;
-          gboolean matched = ft_nn_verify (&self->match_ctx, image,
+          gboolean matched = ft_nn_verify (self->engine, &self->match_ctx, image,
                                         self->verify_templates, self->verify_count,
                                         &result);
           gint64 t_match_end = g_get_monotonic_time ();
 
           /* Log result */
-          fp_dbg ("Verify: matched=%d dist=%.4f templates_below=%d tta=%d/%d ncc=%.4f time=%ldms",
+          fp_dbg ("Verify: matched=%d dist=%.4f templates_below=%d tta=%d/%d (%d evaluated, %d embedded) ncc=%.4f time=%ldms",
                   matched, result.best_distance, result.templates_below_threshold,
-                  result.tta_votes, result.tta_total, result.best_ncc,
+                  result.tta_votes, result.tta_total, result.tta_evaluated,
+                  result.tta_computed, result.best_ncc,
                   (t_match_end - t_match_start) / 1000);
 
           if (self->debug_dir && debug_probe_id > 0)
@@ -383,6 +418,13 @@ capture_read_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GE
           FpPrint *matched_print = NULL;
           float best_distance = 1e30f;
 
+          /* Templates of every print with valid data, and the print each came from */
+          g_autofree const FtNNTemplate **templates = g_new0 (const FtNNTemplate *, prints->len);
+          g_autofree gint *counts = g_new0 (gint, prints->len);
+          g_autofree guint *print_idx = g_new0 (guint, prints->len);
+          g_autofree FtNNMatchResult *results = g_new0 (FtNNMatchResult, prints->len);
+          gint num_loaded = 0;
+
           for (guint i = 0; i < prints->len; i++)
             {
               FpPrint *print = g_ptr_array_index (prints, i);
@@ -395,30 +437,42 @@ capture_read_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GE
               gsize data_len;
               const uint8_t *data = g_variant_get_fixed_array (data_var, &data_len, 1);
 
-              FtNNTemplate *templates;
+              FtNNTemplate *print_templates;
               int count;
 
-              if (deserialize_templates (data, data_len, &templates, &count) == 0)
+              if (deserialize_templates (data, data_len, &print_templates, &count) == 0)
                 {
-                  FtNNMatchResult result;
-                  if (ft_nn_verify (&self->match_ctx, image, templates, count, &result))
-                    {
-                      if (result.best_distance < best_distance)
-                        {
-                          best_distance = result.best_distance;
-                          matched_print = print;
-                        }
-                    }
-                  free (templates);
+                  templates[num_loaded] = print_templates;
+                  counts[num_loaded] = count;
+                  print_idx[num_loaded] = i;
+                  num_loaded++;
                 }
 
               g_variant_unref (data_var);
             }
+
+          /* Probe work is done once; TTA and NCC closest print first, up to a match */
+          ft_nn_probe_init (&self->identify_probe, image);
+          gint found = ft_nn_identify (self->engine, &self->match_ctx, &self->identify_probe,
+                                       templates, counts, num_loaded, results);
+          if (found >= 0)
+            {
+              matched_print = g_ptr_array_index (prints, print_idx[found]);
+              best_distance = results[found].best_distance;
+            }
+
+          for (gint i = 0; i < num_loaded; i++)
+            free ((FtNNTemplate *) templates[i]);
+
           gint64 t_identify_end = g_get_monotonic_time ();
+          guint64 cache_hits, cache_misses;
 
-          fp_dbg ("Identify: %s, best_dist=%.4f, prints=%u, time=%ldms",
+          ft_nn_engine_get_cache_stats (self->engine, &cache_hits, &cache_misses);
+          fp_dbg ("Identify: %s, best_dist=%.4f, prints=%u, time=%ldms, embedding cache %"
+                  G_GUINT64_FORMAT "/%" G_GUINT64_FORMAT " hits",
                   matched_print ? "MATCH" : "NO_MATCH", best_distance, prints->len,
-                  (t_identify_end - t_identify_start) / 1000);
+                  (t_identify_end - t_identify_start) / 1000,
+                  cache_hits, cache_hits + cache_misses);
 
           if (matched_print)
             fpi_device_identify_report (dev, matched_print, NULL, NULL);
@@ -428,16 +482,8 @@ capture_read_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GE
           fpi_device_identify_complete (dev, NULL);
         }
 
-      g_clear_pointer (&self->raw_buffer, g_free);
       self->raw_buffer_len = 0;
     }
-  else
-    {
-      /* Need more data */
-      FpiUsbTransfer *read_transfer = fpi_usb_transfer_new (dev);
-      fpi_usb_transfer_fill_bulk (read_transfer, EP_IN, RAW_IMAGE_SIZE);
-      fpi_usb_transfer_submit (read_transfer, 5000, NULL, capture_read_cb, NULL);
-    }
 }
 
 static void
@@ -455,10 +501,9 @@ capture_cmd_cb (FpiUsbTransfer *transfer, FpDevice *dev, gpointer user_data, GEr
       return;
     }
 
-  /* Initialize buffer */
-  g_clear_pointer (&self->raw_buffer, g_free);
-  self->raw_buffer = g_malloc (RAW_IMAGE_SIZE);
+  /* Reset buffer (allocated in dev_open) */
   self->raw_buffer_len = 0;
+  ft_nn_process_begin (self->engine);
 
   /* Read image data */
   read_transfer = fpi_usb_transfer_new (dev);
@@ -583,6 +628,30 @@ dev_open (FpDevice *dev)
   /* Initialize matcher context */
   ft_nn_match_init (&self->match_ctx);
 
+  /* Map the model file, if any; the first open of the process decides */
+  {
+    const char *model_path = g_getenv ("FP_FOCALTECH_MODEL");
+    int ret = ft_nn_load_model (model_path ? model_path : FT_NN_MODEL_PATH);
+
+    if (ret == 0)
+      fp_dbg ("NN model: %s", model_path ? model_path : FT_NN_MODEL_PATH);
+    else if (model_path || ret != -ENOENT)
+      fp_warn ("Cannot load NN model %s: %s",
+               model_path ? model_path : FT_NN_MODEL_PATH, g_strerror (-ret));
+  }
+
+  /* All capture and matching buffers, so captures do not allocate */
+  self->engine = ft_nn_engine_new ();
+  if (self->engine == NULL)
+    {
+      g_usb_device_release_interface (fpi_device_get_usb_device (dev), 0, 0, NULL);
+      fpi_device_open_complete (dev, fpi_device_error_new (FP_DEVICE_ERROR_GENERAL));
+      return;
+    }
+  self->raw_buffer = g_malloc (RAW_IMAGE_SIZE);
+  self->raw_buffer_len = 0;
+  fp_dbg ("NN kernels: %s", ft_nn_get_kernel_isa ());
+
   fpi_device_open_complete (dev, NULL);
 }
 
@@ -594,6 +663,7 @@ dev_close (FpDevice *dev)
 
   fp_dbg ("Closing device");
 
+  g_clear_pointer (&self->engine, ft_nn_engine_free);
   g_clear_pointer (&self->raw_buffer, g_free);
   g_clear_pointer (&self->enroll_templates, g_free);
   g_clear_pointer (&self->verify_templates, g_free);
@@ -758,6 +828,7 @@ static const FpIdEntry id_table[] = {
 static void
 fpi_device_focaltech0752_init (FpiDeviceFocaltech0752 *self)
 {
+  self->engine = NULL;
   self->raw_buffer = NULL;
   self->raw_buffer_len = 0;
   self->deactivating = FALSE;
@@ -777,6 +848,7 @@ fpi_device_focaltech0752_finalize (GObject *object)
   if (self->poll_timeout_id != 0)
     g_source_remove (self->poll_timeout_id);
 
+  g_clear_pointer (&self->engine, ft_nn_engine_free);
   g_clear_pointer (&self->raw_buffer, g_free);
   g_clear_pointer (&self->enroll_templates, g_free);
   g_clear_pointer (&self->verify_templates, g_free);
@@ -22,13 +22,20 @@
 
         postPatch = (oldAttrs.postPatch or "") + ''
           cp ${./shared/focaltech_nn_weights.h} libfprint/drivers/focaltech_nn_weights.h
+          cp ${./shared/focaltech_nn_model.h} libfprint/drivers/focaltech_nn_model.h
           cp ${./shared/focaltech_nn_infer.c} libfprint/drivers/focaltech_nn_infer.c
           cp ${./shared/focaltech_nn_infer.h} libfprint/drivers/focaltech_nn_infer.h
+          cp ${./shared/focaltech_nn_kernels.c} libfprint/drivers/focaltech_nn_kernels.c
+          cp ${./shared/focaltech_nn_kernels.h} libfprint/drivers/focaltech_nn_kernels.h
           cp ${./shared/focaltech_nn_match.c} libfprint/drivers/focaltech_nn_match.c
           cp ${./shared/focaltech_nn_match.h} libfprint/drivers/focaltech_nn_match.h
+          cp ${./shared/focaltech_nn_tables.h} libfprint/drivers/focaltech_nn_tables.h
           cp ${./driver/focaltech-0752.c} libfprint/drivers/focaltech0752.c
+          substituteInPlace libfprint/drivers/focaltech0752.c \
+            --replace-fail /usr/share/libfprint/focaltech0752.ftnn \
+            ${focaltech0752-model}/share/libfprint/focaltech0752.ftnn
 
-          sed -i "s/    'focaltech_moc' :/    'focaltech0752' :\n        [ 'drivers\/focaltech0752.c', 'drivers\/focaltech_nn_match.c', 'drivers\/focaltech_nn_infer.c' ],\n    'focaltech_moc' :/" libfprint/meson.build
+          sed -i "s/    'focaltech_moc' :/    'focaltech0752' :\n        [ 'drivers\/focaltech0752.c', 'drivers\/focaltech_nn_match.c', 'drivers\/focaltech_nn_infer.c', 'drivers\/focaltech_nn_kernels.c' ],\n    'focaltech_moc' :/" libfprint/meson.build
           sed -i "s/    'focaltech_moc',/    'focaltech_moc',\n    'focaltech0752',/" meson.build
         '';
 
@@ -40,12 +47,35 @@
         '';
       });
 
+      # Weights as an mmap-able model file, the driver's default model path;
+      # libfprint also compiles the weights in, in case the file is unreadable
+      focaltech0752-model = pkgs.stdenv.mkDerivation {
+        pname = "focaltech0752-model";
+        version = "1";
+        src = ./.;
+
+        buildPhase = ''
+          runHook preBuild
+          $CC -O2 -Ishared tools/focaltech_nn_export.c shared/focaltech_nn_kernels.c \
+            -lm -lpthread -o ft-nn-export
+          ./ft-nn-export focaltech0752.ftnn
+          runHook postBuild
+        '';
+
+        installPhase = ''
+          runHook preInstall
+          install -Dm644 focaltech0752.ftnn $out/share/libfprint/focaltech0752.ftnn
+          runHook postInstall
+        '';
+      };
+
       fprintd-focaltech0752 = pkgs.fprintd.override {
         libfprint = libfprint-focaltech0752;
       };
     in {
       packages = {
         libfprint = libfprint-focaltech0752;
+        model = focaltech0752-model;
         fprintd = fprintd-focaltech0752;
         default = fprintd-focaltech0752;
       };
@@ -1,9 +1,34 @@
-/* Auto-generated - DO NOT EDIT */
+/*
+ * FocalTech FT9362 NN inference
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * Maintained by hand. Only the weights are generated: focaltech_nn_weights.h
+ * from training, or a model file from tools/focaltech_nn_export.c.
+ */
+
 #include "focaltech_nn_infer.h"
-#include "focaltech_nn_weights.h"
+#include "focaltech_nn_kernels.h"
+#include "focaltech_nn_model.h"
+#include <errno.h>
+#include <fcntl.h>
 #include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__has_include)
+/* Compiled-in weights, when the generated header is present */
+#if __has_include("focaltech_nn_weights.h")
+#include "focaltech_nn_weights.h"
+#define FT_NN_BUILTIN_WEIGHTS 1
+#endif
+#endif
 
 /* Internal buffer sizes (after each pooling) */
 #define CONV1_OUT_H 38
@@ -31,163 +56,1218 @@ static inline float relu(float x) {
     return x > 0.0f ? x : 0.0f;
 }
 
-/* Conv2d + ReLU: 3x3, padding=1, followed by 2x2 max pooling */
+/* Helper: max that vectorizes (operands are never NaN) */
+static inline float maxf(float a, float b) {
+    return a > b ? a : b;
+}
+
+/* Convolution layer description; weights are in model */
+typedef struct {
+    int in_h, in_w, in_ch;
+    int out_ch, out_h, out_w;
+    int winograd;         /* FT_NN_CONV_AUTO picks Winograd (faster on the bench) */
+} ConvLayer;
+
+static const ConvLayer conv_layers[4] = {
+    /* Conv1: (1, 76, 40) -> (16, 38, 20) */
+    { FT_NN_INPUT_HEIGHT, FT_NN_INPUT_WIDTH, 1,
+      CONV1_OUT_CH, CONV1_OUT_H, CONV1_OUT_W, 0 },
+    /* Conv2: (16, 38, 20) -> (32, 19, 10) */
+    { CONV1_OUT_H, CONV1_OUT_W, CONV1_OUT_CH,
+      CONV2_OUT_CH, CONV2_OUT_H, CONV2_OUT_W, 1 },
+    /* Conv3: (32, 19, 10) -> (64, 9, 5) */
+    { CONV2_OUT_H, CONV2_OUT_W, CONV2_OUT_CH,
+      CONV3_OUT_CH, CONV3_OUT_H, CONV3_OUT_W, 1 },
+    /* Conv4: (64, 9, 5) -> (128, 4, 2) */
+    { CONV3_OUT_H, CONV3_OUT_W, CONV3_OUT_CH,
+      CONV4_OUT_CH, CONV4_OUT_H, CONV4_OUT_W, 1 },
+};
+
+/* Fully connected layer description; weights are in model */
+typedef struct {
+    int in_size, out_size;
+    int relu;             /* ReLU on the output */
+} FcLayer;
+
+static const FcLayer fc_layers[2] = {
+    /* FC1: 1024 -> 256 (with ReLU) */
+    { FC1_IN, FC1_OUT, 1 },
+    /* FC2: 256 -> 64 (no activation) */
+    { FC1_OUT, FC2_OUT, 0 },
+};
+
+/*
+ * Model weights: the compiled-in arrays when built with
+ * focaltech_nn_weights.h, otherwise nothing until ft_nn_load_model() maps
+ * a model file. Packed tensors from the file are used in place; NULL ones
+ * are packed from the plain weights on first use.
+ */
+static struct {
+    const float *conv_weight[4];    /* [out_ch][in_ch][3][3] */
+    const float *conv_bias[4];
+    const float *conv_gemm[4];      /* FT_NN_MODEL_GEMM */
+    const float *conv_winograd[4];  /* FT_NN_MODEL_WINOGRAD */
+    const float *fc_weight[2];      /* [out_size][in_size] */
+    const float *fc_bias[2];
+    const float *fc_gemm[2];
+    const void *map;                /* mapped model file */
+    size_t map_size;
+    int in_use;                     /* set by the first workspace */
+} model = {
+#ifdef FT_NN_BUILTIN_WEIGHTS
+    .conv_weight = { CONV1_WEIGHT, CONV2_WEIGHT, CONV3_WEIGHT, CONV4_WEIGHT },
+    .conv_bias = { CONV1_BIAS, CONV2_BIAS, CONV3_BIAS, CONV4_BIAS },
+    .fc_weight = { FC1_WEIGHT, FC2_WEIGHT },
+    .fc_bias = { FC1_BIAS, FC2_BIAS },
+#endif
+};
+static pthread_mutex_t model_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static FtNNConvAlgo conv_algo = FT_NN_CONV_AUTO;
+
+void ft_nn_set_conv_algo(FtNNConvAlgo algo)
+{
+    conv_algo = algo;
+}
+
+FtNNConvAlgo ft_nn_get_conv_algo(void)
+{
+    return conv_algo;
+}
+
+/*
+ * Conv2d + ReLU: 3x3, padding=1, fused with 2x2 max pooling (reference).
+ *
+ * The four conv outputs of each pooling window are computed together and
+ * only their maximum is stored; conv rows and columns that floor pooling
+ * drops are never computed. relu(max) == max(relu), so this equals ReLU
+ * followed by MaxPool2d(2).
+ */
 static void conv_bn_relu_pool(
     const float *input, int in_h, int in_w, int in_ch,
     const float *weight, const float *bias, int out_ch,
     float *output, int out_h, int out_w)
 {
-    /* Output after conv (before pooling) is same size as input due to padding=1 */
-    int conv_h = in_h;
-    int conv_w = in_w;
+    for (int oc = 0; oc < out_ch; oc++) {
+        for (int oh = 0; oh < out_h; oh++) {
+            for (int ow = 0; ow < out_w; ow++) {
+                float sum[4];
 
-    /* Temporary buffer for conv output (before pooling) */
-    float *conv_out = (float *)malloc(out_ch * conv_h * conv_w * sizeof(float));
+                for (int q = 0; q < 4; q++) {
+                    int ch = oh * 2 + q / 2;  /* conv output pixel of the window */
+                    int cw = ow * 2 + q % 2;
 
-    /* Conv2d with padding=1 */
-    for (int oc = 0; oc < out_ch; oc++) {
-        for (int oh = 0; oh < conv_h; oh++) {
-            for (int ow = 0; ow < conv_w; ow++) {
-                float sum = bias[oc];
-
-                for (int ic = 0; ic < in_ch; ic++) {
-                    for (int kh = 0; kh < 3; kh++) {
-                        for (int kw = 0; kw < 3; kw++) {
-                            int ih = oh + kh - 1;  /* padding=1 */
-                            int iw = ow + kw - 1;
-
-                            if (ih >= 0 && ih < in_h && iw >= 0 && iw < in_w) {
-                                int in_idx = ic * in_h * in_w + ih * in_w + iw;
-                                int w_idx = oc * in_ch * 9 + ic * 9 + kh * 3 + kw;
-                                sum += input[in_idx] * weight[w_idx];
+                    sum[q] = bias[oc];
+                    for (int ic = 0; ic < in_ch; ic++) {
+                        for (int kh = 0; kh < 3; kh++) {
+                            for (int kw = 0; kw < 3; kw++) {
+                                int ih = ch + kh - 1;  /* padding=1 */
+                                int iw = cw + kw - 1;
+
+                                if (ih >= 0 && ih < in_h && iw >= 0 && iw < in_w) {
+                                    int in_idx = ic * in_h * in_w + ih * in_w + iw;
+                                    int w_idx = oc * in_ch * 9 + ic * 9 + kh * 3 + kw;
+                                    sum[q] += input[in_idx] * weight[w_idx];
+                                }
                             }
                         }
                     }
                 }
 
-                /* ReLU */
-                conv_out[oc * conv_h * conv_w + oh * conv_w + ow] = relu(sum);
+                output[oc * out_h * out_w + oh * out_w + ow] =
+                    relu(fmaxf(fmaxf(sum[0], sum[1]), fmaxf(sum[2], sum[3])));
+            }
+        }
+    }
+}
+
+/*
+ * GEMM convolution.
+ *
+ * The 3x3 convolution is computed as C[oc][p] = W[oc][k] * X[k][p] where
+ * k = ic * 9 + kh * 3 + kw runs over the receptive field and p over the
+ * output pixels. X (im2col) is never built in full: output pixels are
+ * processed in spatial tiles whose im2col panel fits in GEMM_PANEL_FLOATS,
+ * and every tile is reused by all output-channel blocks of GEMM_MR rows.
+ * For a batch the columns run over the pixels of every image, so each
+ * weight block is applied to the whole batch while it is hot in cache.
+ *
+ * Columns are ordered by pooling window: each GEMM_NR = 4 column
+ * micro-panel holds the 2x2 conv pixels of one pooled output, so the
+ * micro-kernel tile is max-reduced in registers and only the pooled value
+ * is stored. The full-resolution map is never written, and conv pixels
+ * dropped by floor pooling are never computed.
+ *
+ * Panels are stored as GEMM_NR-column micro-panels laid out [k][GEMM_NR]
+ * and weight blocks as [k][GEMM_MR], so the micro-kernel streams both
+ * operands contiguously. With the scalar kernels each accumulator starts at
+ * the bias and adds the taps in the same order as the direct kernel, and
+ * zero padding contributes exact zeros, so the two paths are bit-identical
+ * unless the compiler contracts multiply-adds; the SIMD kernels use FMA and
+ * agree to FT_NN_EMBEDDING_TOLERANCE.
+ */
+#define GEMM_MR FT_NN_GEMM_MR
+#define GEMM_NR FT_NN_GEMM_NR
+#define GEMM_PANEL_FLOATS 32768  /* im2col panel budget: 128 KB, L2 resident */
+
+#if FT_NN_GEMM_NR != 4
+#error "fused pooling needs one 2x2 window per GEMM_NR-column micro-panel"
+#endif
+
+/* Columns per spatial tile for a reduction of length k */
+static int panel_cols(int k)
+{
+    int nb = (GEMM_PANEL_FLOATS / k) / GEMM_NR * GEMM_NR;
+    return nb < GEMM_NR ? GEMM_NR : nb;
+}
+
+/*
+ * Inference workspace.
+ *
+ * Every buffer a forward pass of up to max_batch images needs is carved out
+ * of one 64-byte aligned arena when the workspace is created, so inference
+ * itself never allocates and engines on different threads share nothing but
+ * the read-only weights.
+ */
+#define WS_ALIGN 64
+
+struct _FtNNWorkspace {
+    int max_batch;
+    float *act[4];       /* pooled output of conv1..conv4 */
+    float *fc1_out;
+    float *shift_base;   /* conv1 output of the image shifted copies are taken from */
+    int *windows;        /* conv1 pooling windows the shifts leave to recompute */
+    float *panel;        /* im2col / Winograd panel, or FC inputs as micro-panels */
+    void *arena;
+};
+
+/*
+ * A layer split into tasks of step columns, tiles or output rows, sized so
+ * that one task's inputs fit the workspace panel.
+ */
+typedef struct {
+    FtNNWorkspace *ws;
+    int l;               /* index into conv_layers / fc_layers */
+    const float *input;
+    float *output;
+    int n;
+    int count, step;
+    const int *windows;  /* convolutions: pooling windows to compute, NULL for all */
+} LayerJob;
+
+typedef void (*LayerTask)(const LayerJob *job, int task);
+
+/* Pooling window i of a job's list, or window i itself when there is no list */
+static inline int job_window(const int *windows, int i)
+{
+    return windows ? windows[i] : i;
+}
+
+/* Run the tasks of a job in order */
+static void layer_run(const LayerJob *job, LayerTask task)
+{
+    for (int t = 0; t * job->step < job->count; t++) {
+        task(job, t);
+    }
+}
+
+/*
+ * Weight prepacking.
+ *
+ * The plain weights are PyTorch OIHW (conv) and row-major [out][in] (FC).
+ * The kernels want them in blocks of GEMM_MR output channels laid out
+ * [k][GEMM_MR] - OIHW16o with the input channel and the 3x3 taps folded
+ * into k - which the GEMM and GEMV micro-kernels stream with unit stride.
+ * A model file carries these packings; for compiled-in weights they are
+ * built once per process in the arenas below. Every block starts on a
+ * 64-byte boundary.
+ */
+#define PACKED_FLOATS (CONV1_OUT_CH * 1 * 9 + CONV2_OUT_CH * CONV1_OUT_CH * 9 + \
+                       CONV3_OUT_CH * CONV2_OUT_CH * 9 + CONV4_OUT_CH * CONV3_OUT_CH * 9 + \
+                       FC1_OUT * FC1_IN + FC2_OUT * FC1_OUT)
+
+static float packed_arena[PACKED_FLOATS] __attribute__((aligned(64)));
+static const float *packed_conv[4];
+static const float *packed_fc[2];
+
+/* Winograd-domain filters: 16 transformed taps per (oc, ic) pair */
+#define WINO_FLOATS (16 * (CONV1_OUT_CH * 1 + CONV2_OUT_CH * CONV1_OUT_CH + \
+                           CONV3_OUT_CH * CONV2_OUT_CH + CONV4_OUT_CH * CONV3_OUT_CH))
+
+static float wino_arena[WINO_FLOATS] __attribute__((aligned(64)));
+static const float *wino_conv[4];
+static pthread_once_t prepack_once = PTHREAD_ONCE_INIT;
+
+/* Reorder weights [out_ch][k] into GEMM_MR-row blocks laid out [k][GEMM_MR] */
+static void pack_weights(const float *weight, int out_ch, int k, float *packed)
+{
+    for (int oc0 = 0; oc0 < out_ch; oc0 += GEMM_MR) {
+        float *dst = packed + oc0 * k;
+        for (int p = 0; p < k; p++) {
+            for (int i = 0; i < GEMM_MR; i++) {
+                dst[p * GEMM_MR + i] = weight[(oc0 + i) * k + p];
             }
         }
     }
+}
 
-    /* MaxPool2d with kernel=2, stride=2 */
+/*
+ * Transform 3x3 filters to the Winograd domain, U = G g G^T, and pack the
+ * 4x4 results as 16 weight matrices [xi][out_ch / GEMM_MR][in_ch][GEMM_MR].
+ */
+static void pack_winograd(const float *weight, int out_ch, int in_ch, float *packed)
+{
     for (int oc = 0; oc < out_ch; oc++) {
-        for (int oh = 0; oh < out_h; oh++) {
-            for (int ow = 0; ow < out_w; ow++) {
-                float max_val = -1e30f;
+        for (int ic = 0; ic < in_ch; ic++) {
+            const float *g = weight + (oc * in_ch + ic) * 9;
+            float t[4][3], u[4][4];
 
-                for (int kh = 0; kh < 2; kh++) {
-                    for (int kw = 0; kw < 2; kw++) {
-                        int ih = oh * 2 + kh;
-                        int iw = ow * 2 + kw;
+            for (int c = 0; c < 3; c++) {
+                t[0][c] = g[c];
+                t[1][c] = 0.5f * (g[c] + g[3 + c] + g[6 + c]);
+                t[2][c] = 0.5f * (g[c] - g[3 + c] + g[6 + c]);
+                t[3][c] = g[6 + c];
+            }
+            for (int r = 0; r < 4; r++) {
+                u[r][0] = t[r][0];
+                u[r][1] = 0.5f * (t[r][0] + t[r][1] + t[r][2]);
+                u[r][2] = 0.5f * (t[r][0] - t[r][1] + t[r][2]);
+                u[r][3] = t[r][2];
+            }
 
-                        if (ih < conv_h && iw < conv_w) {
-                            float val = conv_out[oc * conv_h * conv_w + ih * conv_w + iw];
-                            if (val > max_val) max_val = val;
-                        }
+            for (int xi = 0; xi < 16; xi++) {
+                float *dst = packed + xi * out_ch * in_ch + (oc / GEMM_MR) * in_ch * GEMM_MR;
+                dst[ic * GEMM_MR + oc % GEMM_MR] = u[xi / 4][xi % 4];
+            }
+        }
+    }
+}
+
+static void prepack_weights(void)
+{
+    float *dst = packed_arena;
+    float *wino = wino_arena;
+
+    /* Block sizes are multiples of GEMM_MR floats, so alignment carries over */
+    for (int l = 0; l < 4; l++) {
+        const ConvLayer *layer = &conv_layers[l];
+        int k = layer->in_ch * 9;
+
+        if (model.conv_gemm[l]) {
+            packed_conv[l] = model.conv_gemm[l];
+        } else {
+            pack_weights(model.conv_weight[l], layer->out_ch, k, dst);
+            packed_conv[l] = dst;
+        }
+        dst += layer->out_ch * k;
+
+        if (model.conv_winograd[l]) {
+            wino_conv[l] = model.conv_winograd[l];
+        } else {
+            pack_winograd(model.conv_weight[l], layer->out_ch, layer->in_ch, wino);
+            wino_conv[l] = wino;
+        }
+        wino += 16 * layer->out_ch * layer->in_ch;
+    }
+    for (int l = 0; l < 2; l++) {
+        if (model.fc_gemm[l]) {
+            packed_fc[l] = model.fc_gemm[l];
+        } else {
+            pack_weights(model.fc_weight[l], fc_layers[l].out_size, fc_layers[l].in_size, dst);
+            packed_fc[l] = dst;
+        }
+        dst += fc_layers[l].out_size * fc_layers[l].in_size;
+    }
+}
+
+/*
+ * Model files.
+ *
+ * The tensors of a model file, in file order: for every conv layer its
+ * plain weight, bias, GEMM and Winograd packings, then for every FC layer
+ * its plain weight, bias and GEMM packing.
+ */
+#define MODEL_TENSORS (4 * 4 + 2 * 3)
+
+/* Expected name, layout and shape of tensor t; size is set, offset is not */
+static void model_tensor_spec(int t, FtNNModelTensor *spec)
+{
+    static const char *const conv_kinds[4] = { "weight", "bias", "gemm", "winograd" };
+    static const char *const fc_kinds[3] = { "weight", "bias", "gemm" };
+    uint64_t count = 1;
+
+    memset(spec, 0, sizeof(*spec));
+
+    if (t < 16) {
+        const ConvLayer *layer = &conv_layers[t / 4];
+        int kind = t % 4;
+
+        snprintf(spec->name, sizeof(spec->name), "conv%d.%s", t / 4 + 1, conv_kinds[kind]);
+        switch (kind) {
+        case 0:
+            spec->layout = FT_NN_MODEL_PLAIN;
+            spec->ndim = 4;
+            spec->dims[0] = layer->out_ch;
+            spec->dims[1] = layer->in_ch;
+            spec->dims[2] = 3;
+            spec->dims[3] = 3;
+            break;
+        case 1:
+            spec->layout = FT_NN_MODEL_PLAIN;
+            spec->ndim = 1;
+            spec->dims[0] = layer->out_ch;
+            break;
+        case 2:
+            spec->layout = FT_NN_MODEL_GEMM;
+            spec->ndim = 2;
+            spec->dims[0] = layer->out_ch;
+            spec->dims[1] = layer->in_ch * 9;
+            break;
+        default:
+            spec->layout = FT_NN_MODEL_WINOGRAD;
+            spec->ndim = 3;
+            spec->dims[0] = 16;
+            spec->dims[1] = layer->out_ch;
+            spec->dims[2] = layer->in_ch;
+            break;
+        }
+    } else {
+        const FcLayer *layer = &fc_layers[(t - 16) / 3];
+        int kind = (t - 16) % 3;
+
+        snprintf(spec->name, sizeof(spec->name), "fc%d.%s", (t - 16) / 3 + 1, fc_kinds[kind]);
+        spec->layout = kind == 2 ? FT_NN_MODEL_GEMM : FT_NN_MODEL_PLAIN;
+        spec->ndim = kind == 1 ? 1 : 2;
+        spec->dims[0] = layer->out_size;
+        spec->dims[1] = kind == 1 ? 0 : layer->in_size;
+    }
+
+    for (uint32_t d = 0; d < spec->ndim; d++) {
+        count *= spec->dims[d];
+    }
+    spec->size = count * sizeof(float);
+}
+
+/* Where tensor t is bound in model */
+static const float **model_tensor_slot(int t)
+{
+    if (t < 16) {
+        switch (t % 4) {
+        case 0: return &model.conv_weight[t / 4];
+        case 1: return &model.conv_bias[t / 4];
+        case 2: return &model.conv_gemm[t / 4];
+        default: return &model.conv_winograd[t / 4];
+        }
+    }
+    switch ((t - 16) % 3) {
+    case 0: return &model.fc_weight[(t - 16) / 3];
+    case 1: return &model.fc_bias[(t - 16) / 3];
+    default: return &model.fc_gemm[(t - 16) / 3];
+    }
+}
+
+/* CRC-32 (IEEE 802.3, reflected) */
+static uint32_t model_crc32(uint32_t crc, const void *data, size_t len)
+{
+    static uint32_t table[256];
+    const unsigned char *p = (const unsigned char *)data;
+
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int b = 0; b < 8; b++) {
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+    }
+
+    crc = ~crc;
+    while (len--) {
+        crc = table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/* Checksum of a whole model file, its checksum field counted as zero */
+static uint32_t model_checksum(const unsigned char *file, size_t size)
+{
+    FtNNModelHeader header;
+    uint32_t crc;
+
+    memcpy(&header, file, sizeof(header));
+    header.checksum = 0;
+    crc = model_crc32(0, &header, sizeof(header));
+    return model_crc32(crc, file + sizeof(header), size - sizeof(header));
+}
+
+/* Check a mapped model file against the network; 0 or a negative errno */
+static int model_validate(const unsigned char *file, size_t size)
+{
+    FtNNModelHeader header;
+
+    if (size < sizeof(header))
+        return -EINVAL;
+    memcpy(&header, file, sizeof(header));
+
+    if (memcmp(header.magic, FT_NN_MODEL_MAGIC, sizeof(header.magic)) != 0 ||
+        header.header_size != sizeof(header) || header.file_size != size)
+        return -EINVAL;
+    if (header.version != FT_NN_MODEL_VERSION || header.dtype != FT_NN_MODEL_F32)
+        return -ENOTSUP;
+    if (header.alignment == 0 || header.alignment % FT_NN_MODEL_ALIGN != 0 ||
+        header.n_tensors != MODEL_TENSORS)
+        return -EINVAL;
+    if (model_checksum(file, size) != header.checksum)
+        return -EBADMSG;
+
+    for (int t = 0; t < MODEL_TENSORS; t++) {
+        const FtNNModelTensor *tensor = &header.tensors[t];
+        FtNNModelTensor spec;
+
+        model_tensor_spec(t, &spec);
+        if (strncmp(tensor->name, spec.name, sizeof(spec.name)) != 0 ||
+            tensor->layout != spec.layout || tensor->ndim != spec.ndim ||
+            memcmp(tensor->dims, spec.dims, sizeof(spec.dims)) != 0 ||
+            tensor->size != spec.size || tensor->offset % header.alignment != 0 ||
+            tensor->offset < sizeof(header) || tensor->offset > size ||
+            tensor->size > size - tensor->offset)
+            return -EINVAL;
+    }
+    return 0;
+}
+
+int ft_nn_load_model(const char *path)
+{
+    const FtNNModelHeader *header;
+    unsigned char *file;
+    struct stat st;
+    int fd, ret;
+
+    pthread_mutex_lock(&model_lock);
+
+    /* The first model stays mapped for the life of the process */
+    if (model.map != NULL) {
+        ret = 0;
+        goto out;
+    }
+    if (model.in_use) {
+        ret = -EBUSY;
+        goto out;
+    }
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        ret = -errno;
+        goto out;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(FtNNModelHeader)) {
+        ret = -EINVAL;
+        close(fd);
+        goto out;
+    }
+    file = (unsigned char *)mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (file == MAP_FAILED) {
+        ret = -errno;
+        goto out;
+    }
+
+    ret = model_validate(file, st.st_size);
+    if (ret != 0) {
+        munmap(file, st.st_size);
+        goto out;
+    }
+
+    /* Packings for another block height are rebuilt from the plain weights */
+    header = (const FtNNModelHeader *)file;
+    for (int t = 0; t < MODEL_TENSORS; t++) {
+        int packed = header->tensors[t].layout != FT_NN_MODEL_PLAIN;
+
+        *model_tensor_slot(t) = packed && header->gemm_mr != GEMM_MR ? NULL :
+                                (const float *)(file + header->tensors[t].offset);
+    }
+    model.map = file;
+    model.map_size = st.st_size;
+
+out:
+    pthread_mutex_unlock(&model_lock);
+    return ret;
+}
+
+/* Fix the weights for the life of the process; 0 when there are none */
+static int model_bind(void)
+{
+    int ready;
+
+    pthread_mutex_lock(&model_lock);
+    ready = model.conv_weight[0] != NULL;
+    model.in_use |= ready;
+    pthread_mutex_unlock(&model_lock);
+    return ready;
+}
+
+/*
+ * Gather the receptive field of conv pixel (oh, ow) into dst[idx * stride]
+ * for idx = ic * 9 + kh * 3 + kw, with zeros for the padding taps.
+ */
+#define IM2COL_GATHER(type, image, in_h, in_w, in_ch, oh, ow, dst, stride)            \
+    do {                                                                             \
+        int npix_ = (in_h) * (in_w);                                                 \
+        if ((oh) > 0 && (oh) < (in_h) - 1 && (ow) > 0 && (ow) < (in_w) - 1) {        \
+            const type *src_ = (image) + ((oh) - 1) * (in_w) + (ow) - 1;             \
+            for (int ic_ = 0; ic_ < (in_ch); ic_++, src_ += npix_) {                 \
+                type *d_ = (dst) + ic_ * 9 * (stride);                               \
+                d_[0 * (stride)] = src_[0];                                          \
+                d_[1 * (stride)] = src_[1];                                          \
+                d_[2 * (stride)] = src_[2];                                          \
+                d_[3 * (stride)] = src_[(in_w)];                                     \
+                d_[4 * (stride)] = src_[(in_w) + 1];                                 \
+                d_[5 * (stride)] = src_[(in_w) + 2];                                 \
+                d_[6 * (stride)] = src_[2 * (in_w)];                                 \
+                d_[7 * (stride)] = src_[2 * (in_w) + 1];                             \
+                d_[8 * (stride)] = src_[2 * (in_w) + 2];                             \
+            }                                                                        \
+        } else {                                                                     \
+            for (int ic_ = 0; ic_ < (in_ch); ic_++) {                                \
+                const type *plane_ = (image) + ic_ * npix_;                          \
+                for (int kh_ = 0; kh_ < 3; kh_++) {                                  \
+                    for (int kw_ = 0; kw_ < 3; kw_++) {                              \
+                        int ih_ = (oh) + kh_ - 1;  /* padding=1 */                   \
+                        int iw_ = (ow) + kw_ - 1;                                    \
+                        type val_ = 0;                                               \
+                        if (ih_ >= 0 && ih_ < (in_h) && iw_ >= 0 && iw_ < (in_w)) {  \
+                            val_ = plane_[ih_ * (in_w) + iw_];                       \
+                        }                                                            \
+                        (dst)[(ic_ * 9 + kh_ * 3 + kw_) * (stride)] = val_;          \
+                    }                                                                \
+                }                                                                    \
+            }                                                                        \
+        }                                                                            \
+    } while (0)
+
+/*
+ * Build the im2col micro-panels for batch columns [c0, c0 + nc). Column
+ * c is pixel c % 4 of pooling window c / 4 of the list (see job_window);
+ * windows run over the pooled outputs of every image.
+ */
+static void im2col_panel(
+    const float *input, const ConvLayer *layer, const int *windows, int c0, int nc, float *panel)
+{
+    int in_size = layer->in_ch * layer->in_h * layer->in_w;
+    int opix = layer->out_h * layer->out_w;
+    int k = layer->in_ch * 9;
+
+    for (int j0 = 0; j0 < nc; j0 += GEMM_NR) {
+        int win = job_window(windows, (c0 + j0) / 4);
+        const float *image = input + (win / opix) * in_size;
+        int ph = (win % opix) / layer->out_w;
+        int pw = (win % opix) % layer->out_w;
+        float *dst = panel + j0 * k;
+
+        /* Fast path: the 4x4 input patch of the window is clear of the padding */
+        if (ph > 0 && ph * 2 + 2 < layer->in_h && pw > 0 && pw * 2 + 2 < layer->in_w) {
+            const float *src = image + (ph * 2 - 1) * layer->in_w + pw * 2 - 1;
+            int npix = layer->in_h * layer->in_w;
+
+            for (int ic = 0; ic < layer->in_ch; ic++, src += npix) {
+                for (int kh = 0; kh < 3; kh++) {
+                    const float *r0 = src + kh * layer->in_w;
+                    const float *r1 = r0 + layer->in_w;
+                    float *d = dst + (ic * 9 + kh * 3) * GEMM_NR;
+
+                    for (int kw = 0; kw < 3; kw++, d += GEMM_NR) {
+                        d[0] = r0[kw];
+                        d[1] = r0[kw + 1];
+                        d[2] = r1[kw];
+                        d[3] = r1[kw + 1];
                     }
                 }
+            }
+            continue;
+        }
+
+        for (int j = 0; j < GEMM_NR; j++) {
+            int oh = ph * 2 + j / 2;
+            int ow = pw * 2 + j % 2;
+
+            IM2COL_GATHER(float, image, layer->in_h, layer->in_w, layer->in_ch,
+                          oh, ow, dst + j, GEMM_NR);
+        }
+    }
+}
+
+/* im2col GEMM of batch columns [c0, c0 + nc) of a layer job */
+static void conv_gemm_task(const LayerJob *job, int task)
+{
+    int l = job->l;
+    const ConvLayer *layer = &conv_layers[l];
+    const float *packed = packed_conv[l];
+    int opix = layer->out_h * layer->out_w;
+    int k = layer->in_ch * 9;
+    int c0 = task * job->step;
+    int nc = job->count - c0 < job->step ? job->count - c0 : job->step;
+    float tile[GEMM_NR * GEMM_MR];
+    const FtNNKernels *kernels = ft_nn_kernels();
+
+    float *panel = job->ws->panel;
+
+    im2col_panel(job->input, layer, job->windows, c0, nc, panel);
+
+    for (int oc0 = 0; oc0 < layer->out_ch; oc0 += GEMM_MR) {
+        for (int j0 = 0; j0 < nc; j0 += GEMM_NR) {
+            int win = job_window(job->windows, (c0 + j0) / 4);
+            float *dst = job->output + (win / opix) * layer->out_ch * opix + win % opix;
 
-                output[oc * out_h * out_w + oh * out_w + ow] = max_val;
+            kernels->gemm(k, packed + oc0 * k, panel + j0 * k,
+                          model.conv_bias[l] + oc0, tile);
+
+            for (int i = 0; i < GEMM_MR; i++) {
+                float m = maxf(maxf(tile[0 * GEMM_MR + i], tile[1 * GEMM_MR + i]),
+                               maxf(tile[2 * GEMM_MR + i], tile[3 * GEMM_MR + i]));
+                dst[(oc0 + i) * opix] = relu(m);
+            }
+        }
+    }
+}
+
+/* Conv2d + ReLU + 2x2 max pooling of n images through im2col panels and a blocked GEMM */
+static void conv_gemm_relu_pool(FtNNWorkspace *ws, int l, const float *input, int n,
+                                float *output)
+{
+    const ConvLayer *layer = &conv_layers[l];
+    LayerJob job = { ws, l, input, output, n, n * layer->out_h * layer->out_w * 4, 0, NULL };
+
+    /* Spatial tiles: as many micro-panels as fit the panel budget */
+    job.step = panel_cols(layer->in_ch * 9);
+    layer_run(&job, conv_gemm_task);
+}
+
+/*
+ * Winograd convolution.
+ *
+ * F(2x2, 3x3) computes a 2x2 block of conv outputs from a 4x4 input patch
+ * as Y = A^T [(G g G^T) . (B^T d B)] A, 16 multiplies per input channel
+ * instead of 36. The 2x2 output block is exactly one pooling window, so
+ * every tile is max-reduced as soon as it is transformed back.
+ *
+ * Summed over input channels, the element-wise products become 16
+ * independent GEMMs M[xi] = U[xi] * V[xi] with k = in_ch, one per
+ * transformed tap xi, which run on the same micro-kernel as the im2col
+ * path. Tiles are processed in chunks whose transformed inputs V fit
+ * GEMM_PANEL_FLOATS; for every GEMM_NR tiles and GEMM_MR output channels
+ * the 16 accumulator tiles are gathered and transformed back in registers.
+ *
+ * The transforms reassociate the sums, so results agree with the direct
+ * path to FT_NN_EMBEDDING_TOLERANCE rather than bit for bit.
+ */
+
+/*
+ * Transformed input micro-panels [ntiles / GEMM_NR][16][in_ch][GEMM_NR] for
+ * tiles [t0, t0 + nt). Keeping the 16 taps of a tile close together also
+ * keeps their stores out of each other's cache sets.
+ */
+static void winograd_input(const float *input, const ConvLayer *layer, const int *windows,
+                           int t0, int nt, int ntiles, float *panel)
+{
+    int in_size = layer->in_ch * layer->in_h * layer->in_w;
+    int npix = layer->in_h * layer->in_w;
+    int opix = layer->out_h * layer->out_w;
+    int in_ch = layer->in_ch;
+
+    for (int t = 0; t < ntiles; t++) {
+        int win = t < nt ? job_window(windows, t0 + t) : t0;
+        const float *image = input + (win / opix) * in_size;
+        int ih0 = (win % opix) / layer->out_w * 2 - 1;
+        int iw0 = (win % opix) % layer->out_w * 2 - 1;
+        int interior = ih0 >= 0 && ih0 + 4 <= layer->in_h && iw0 >= 0 && iw0 + 4 <= layer->in_w;
+        float *dst = panel + (t / GEMM_NR) * 16 * in_ch * GEMM_NR + t % GEMM_NR;
+
+        for (int ic = 0; ic < in_ch; ic++) {
+            float d[4][4], b[4][4];
+
+            /* 4x4 input patch, zero-padded; tiles past nt only pad the last micro-panel */
+            if (t < nt && interior) {
+                const float *src = image + ic * npix + ih0 * layer->in_w + iw0;
+                for (int r = 0; r < 4; r++) {
+                    for (int c = 0; c < 4; c++) {
+                        d[r][c] = src[r * layer->in_w + c];
+                    }
+                }
+            } else {
+                for (int r = 0; r < 4; r++) {
+                    for (int c = 0; c < 4; c++) {
+                        int ih = ih0 + r, iw = iw0 + c;
+                        d[r][c] = t < nt && ih >= 0 && ih < layer->in_h && iw >= 0 && iw < layer->in_w ?
+                                  image[ic * npix + ih * layer->in_w + iw] : 0.0f;
+                    }
+                }
+            }
+
+            /* B^T d B */
+            for (int c = 0; c < 4; c++) {
+                b[0][c] = d[0][c] - d[2][c];
+                b[1][c] = d[1][c] + d[2][c];
+                b[2][c] = d[2][c] - d[1][c];
+                b[3][c] = d[1][c] - d[3][c];
+            }
+            for (int r = 0; r < 4; r++) {
+                float *v = dst + (r * 4 * in_ch + ic) * GEMM_NR;
+                int xs = in_ch * GEMM_NR;
+
+                v[0 * xs] = b[r][0] - b[r][2];
+                v[1 * xs] = b[r][1] + b[r][2];
+                v[2 * xs] = b[r][2] - b[r][1];
+                v[3 * xs] = b[r][1] - b[r][3];
+            }
+        }
+    }
+}
+
+/* Winograd tiles [t0, t0 + nt) of a layer job */
+static void conv_winograd_task(const LayerJob *job, int task)
+{
+    static const float zero[GEMM_MR];
+    int l = job->l;
+    const ConvLayer *layer = &conv_layers[l];
+    const float *u = wino_conv[l];
+    int opix = layer->out_h * layer->out_w;
+    int in_ch = layer->in_ch;
+    int out_ch = layer->out_ch;
+    int t0 = task * job->step;
+    int nt = job->count - t0 < job->step ? job->count - t0 : job->step;
+    int ntiles = (nt + GEMM_NR - 1) / GEMM_NR * GEMM_NR;
+    float m[16][GEMM_NR * GEMM_MR];
+    const FtNNKernels *kernels = ft_nn_kernels();
+
+    float *panel = job->ws->panel;
+
+    winograd_input(job->input, layer, job->windows, t0, nt, ntiles, panel);
+
+    for (int oc0 = 0; oc0 < out_ch; oc0 += GEMM_MR) {
+        for (int j0 = 0; j0 < nt; j0 += GEMM_NR) {
+            for (int xi = 0; xi < 16; xi++) {
+                kernels->gemm(in_ch, u + (xi * out_ch + oc0) * in_ch,
+                              panel + (j0 * 16 + xi * GEMM_NR) * in_ch, zero, m[xi]);
+            }
+
+            for (int j = 0; j < GEMM_NR && j0 + j < nt; j++) {
+                int win = job_window(job->windows, t0 + j0 + j);
+                float *dst = job->output + (win / opix) * out_ch * opix + win % opix;
+                float pool[GEMM_MR];
+
+                /* A^T M A, vectorized across the GEMM_MR output channels */
+                for (int i = 0; i < GEMM_MR; i++) {
+#define M(xi) m[xi][j * GEMM_MR + i]
+                    float s00 = M(0) + M(4) + M(8), s10 = M(4) - M(8) - M(12);
+                    float s01 = M(1) + M(5) + M(9), s11 = M(5) - M(9) - M(13);
+                    float s02 = M(2) + M(6) + M(10), s12 = M(6) - M(10) - M(14);
+                    float s03 = M(3) + M(7) + M(11), s13 = M(7) - M(11) - M(15);
+#undef M
+                    float y0 = s00 + s01 + s02, y1 = s01 - s02 - s03;
+                    float y2 = s10 + s11 + s12, y3 = s11 - s12 - s13;
+
+                    pool[i] = maxf(maxf(y0, y1), maxf(y2, y3));
+                }
+
+                for (int i = 0; i < GEMM_MR; i++) {
+                    dst[(oc0 + i) * opix] = relu(pool[i] + model.conv_bias[l][oc0 + i]);
+                }
             }
         }
     }
+}
+
+/* Conv2d + ReLU + 2x2 max pooling of n images with Winograd F(2x2, 3x3) */
+static void conv_winograd_relu_pool(FtNNWorkspace *ws, int l, const float *input, int n,
+                                    float *output)
+{
+    const ConvLayer *layer = &conv_layers[l];
+    LayerJob job = { ws, l, input, output, n, n * layer->out_h * layer->out_w, 0, NULL };
 
-    free(conv_out);
+    /* Tile chunks whose transformed inputs fit the panel budget */
+    job.step = panel_cols(16 * layer->in_ch);
+    layer_run(&job, conv_winograd_task);
 }
 
-/* Fully connected layer + ReLU */
-static void fc_relu(
-    const float *input, int in_size,
-    const float *weight, const float *bias, int out_size,
-    float *output)
+/*
+ * Fully connected layer (+ ReLU) over n inputs. A single input is a GEMV
+ * over the packed blocks; a batch is a GEMM with the inputs as columns, so
+ * every block of GEMM_MR weight rows is loaded once for the whole batch
+ * instead of once per image. Tasks take blocks of output rows.
+ */
+static void fc_task(const LayerJob *job, int task)
 {
-    for (int o = 0; o < out_size; o++) {
-        float sum = bias[o];
-        for (int i = 0; i < in_size; i++) {
-            sum += input[i] * weight[o * in_size + i];
+    int l = job->l;
+    const FcLayer *layer = &fc_layers[l];
+    int apply_relu = layer->relu;
+    const float *packed = packed_fc[l];
+    int in_size = layer->in_size;
+    int out_size = layer->out_size;
+    int n = job->n;
+    int start = task * job->step;
+    int end = start + job->step < out_size ? start + job->step : out_size;
+    float tile[GEMM_NR * GEMM_MR];
+    const FtNNKernels *kernels = ft_nn_kernels();
+    const float *panel = job->ws->panel;
+
+    if (n == 1) {
+        for (int o0 = start; o0 < end; o0 += GEMM_MR) {
+            kernels->gemv(in_size, packed + o0 * in_size, job->input, model.fc_bias[l] + o0,
+                          job->output + o0);
+        }
+        if (apply_relu) {
+            for (int o = start; o < end; o++) {
+                job->output[o] = relu(job->output[o]);
+            }
+        }
+        return;
+    }
+
+    for (int o0 = start; o0 < end; o0 += GEMM_MR) {
+        for (int j0 = 0; j0 < n; j0 += GEMM_NR) {
+            kernels->gemm(in_size, packed + o0 * in_size, panel + j0 * in_size,
+                          model.fc_bias[l] + o0, tile);
+
+            for (int j = 0; j < GEMM_NR && j0 + j < n; j++) {
+                for (int i = 0; i < GEMM_MR; i++) {
+                    float val = tile[j * GEMM_MR + i];
+                    job->output[(j0 + j) * out_size + o0 + i] = apply_relu ? relu(val) : val;
+                }
+            }
         }
-        output[o] = relu(sum);
     }
 }
 
-/* Fully connected layer (no activation) */
-static void fc(
-    const float *input, int in_size,
-    const float *weight, const float *bias, int out_size,
-    float *output)
+static void fc_forward(FtNNWorkspace *ws, int l, const float *input, int n, float *output)
 {
-    for (int o = 0; o < out_size; o++) {
-        float sum = bias[o];
-        for (int i = 0; i < in_size; i++) {
-            sum += input[i] * weight[o * in_size + i];
+    const FcLayer *layer = &fc_layers[l];
+    LayerJob job = { ws, l, input, output, n, layer->out_size, 0, NULL };
+
+    if (n > 1) {
+        int in_size = layer->in_size;
+        int ncols = (n + GEMM_NR - 1) / GEMM_NR * GEMM_NR;
+        float *panel = ws->panel;
+
+        /* Inputs as micro-panels [in_size][GEMM_NR], zero-padded to GEMM_NR columns */
+        for (int j0 = 0; j0 < ncols; j0 += GEMM_NR) {
+            float *dst = panel + j0 * in_size;
+            for (int j = 0; j < GEMM_NR; j++) {
+                for (int i = 0; i < in_size; i++) {
+                    dst[i * GEMM_NR + j] = j0 + j < n ? input[(j0 + j) * in_size + i] : 0.0f;
+                }
+            }
         }
-        output[o] = sum;
+    }
+
+    job.step = job.count;
+    layer_run(&job, fc_task);
+}
+
+static int conv_uses_winograd(int l)
+{
+    return conv_algo == FT_NN_CONV_WINOGRAD ||
+           (conv_algo == FT_NN_CONV_AUTO && conv_layers[l].winograd);
+}
+
+static void conv_layer_forward(FtNNWorkspace *ws, int l, const float *input, int n, float *output)
+{
+    const ConvLayer *layer = &conv_layers[l];
+    int in_size = layer->in_ch * layer->in_h * layer->in_w;
+    int out_size = layer->out_ch * layer->out_h * layer->out_w;
+
+    if (conv_uses_winograd(l)) {
+        conv_winograd_relu_pool(ws, l, input, n, output);
+    } else if (conv_algo == FT_NN_CONV_DIRECT) {
+        for (int b = 0; b < n; b++) {
+            conv_bn_relu_pool(
+                input + b * in_size, layer->in_h, layer->in_w, layer->in_ch,
+                model.conv_weight[l], model.conv_bias[l], layer->out_ch,
+                output + b * out_size, layer->out_h, layer->out_w);
+        }
+    } else {
+        conv_gemm_relu_pool(ws, l, input, n, output);
+    }
+}
+
+/*
+ * conv1 of the listed pooling windows only, with the GEMM or Winograd
+ * kernel conv_layer_forward() would use. Every window is computed alone,
+ * so the results are those of the whole layer bit for bit.
+ */
+static void conv1_windows(FtNNWorkspace *ws, const float *input, const int *windows, int count,
+                          float *output)
+{
+    const ConvLayer *layer = &conv_layers[0];
+    LayerJob job = { ws, 0, input, output, 0, count, 0, windows };
+
+    if (count == 0)
+        return;
+
+    if (conv_uses_winograd(0)) {
+        job.step = panel_cols(16 * layer->in_ch);
+        layer_run(&job, conv_winograd_task);
+    } else {
+        job.count = count * 4;
+        job.step = panel_cols(layer->in_ch * 9);
+        layer_run(&job, conv_gemm_task);
     }
 }
 
 /* L2 normalize */
 static void l2_normalize(float *vec, int size) {
-    float norm = 0.0f;
-    for (int i = 0; i < size; i++) {
-        norm += vec[i] * vec[i];
+    ft_nn_kernels()->l2_normalize(vec, size);
+}
+
+const char *ft_nn_get_kernel_isa(void)
+{
+    return ft_nn_kernels()->name;
+}
+
+/* Reserve the next buffer of the arena, or only measure it while arena is NULL */
+static void *ws_take(FtNNWorkspace *ws, size_t *offset, size_t bytes)
+{
+    void *ptr = ws->arena ? (char *)ws->arena + *offset : NULL;
+    *offset += (bytes + WS_ALIGN - 1) & ~(size_t)(WS_ALIGN - 1);
+    return ptr;
+}
+
+/* Lay out the workspace buffers for ws->max_batch images; returns the arena size */
+static size_t ws_layout(FtNNWorkspace *ws)
+{
+    int batch = ws->max_batch;
+    int fc_cols = (batch + GEMM_NR - 1) / GEMM_NR * GEMM_NR;
+    size_t panel = (size_t)fc_cols * FC1_IN;
+    size_t offset = 0;
+
+    for (int l = 0; l < 4; l++) {
+        const ConvLayer *layer = &conv_layers[l];
+        int k = layer->in_ch * 9;
+
+        ws->act[l] = (float *)ws_take(ws, &offset, (size_t)batch * layer->out_ch *
+                                      layer->out_h * layer->out_w * sizeof(float));
+
+        if ((size_t)panel_cols(k) * k > panel) panel = (size_t)panel_cols(k) * k;
+        if ((size_t)panel_cols(16 * layer->in_ch) * 16 * layer->in_ch > panel)
+            panel = (size_t)panel_cols(16 * layer->in_ch) * 16 * layer->in_ch;
     }
-    norm = sqrtf(norm + 1e-8f);
-    for (int i = 0; i < size; i++) {
-        vec[i] /= norm;
+
+    ws->fc1_out = (float *)ws_take(ws, &offset, (size_t)batch * FC1_OUT * sizeof(float));
+    ws->shift_base = (float *)ws_take(ws, &offset, (size_t)CONV1_OUT_CH * CONV1_OUT_H *
+                                      CONV1_OUT_W * sizeof(float));
+    ws->windows = (int *)ws_take(ws, &offset, (size_t)batch * CONV1_OUT_H * CONV1_OUT_W *
+                                 sizeof(int));
+    ws->panel = (float *)ws_take(ws, &offset, panel * sizeof(float));
+
+    return offset;
+}
+
+FtNNWorkspace *ft_nn_workspace_new(int max_batch)
+{
+    FtNNWorkspace *ws;
+    size_t size;
+
+    if (!model_bind())
+        return NULL;
+
+    ws = (FtNNWorkspace *)calloc(1, sizeof(FtNNWorkspace));
+    if (ws == NULL)
+        return NULL;
+
+    ws->max_batch = max_batch > 0 ? max_batch : 1;
+    size = ws_layout(ws);
+
+    if (posix_memalign(&ws->arena, WS_ALIGN, size) != 0) {
+        free(ws);
+        return NULL;
     }
+    /* Fault the pages in now rather than on the first capture */
+    memset(ws->arena, 0, size);
+    ws_layout(ws);
+
+    /* Likewise pick the kernels and pack the weights up front */
+    ft_nn_kernels();
+    pthread_once(&prepack_once, prepack_weights);
+
+    return ws;
 }
 
-void ft_nn_compute_embedding(const float *input, float *output)
+void ft_nn_workspace_free(FtNNWorkspace *ws)
 {
-    /* Allocate intermediate buffers on stack */
-    float buf1[CONV1_OUT_CH * CONV1_OUT_H * CONV1_OUT_W];  /* 16 * 38 * 20 = 12160 */
-    float buf2[CONV2_OUT_CH * CONV2_OUT_H * CONV2_OUT_W];  /* 32 * 19 * 10 = 6080 */
-    float buf3[CONV3_OUT_CH * CONV3_OUT_H * CONV3_OUT_W];  /* 64 * 9 * 5 = 2880 */
-    float buf4[CONV4_OUT_CH * CONV4_OUT_H * CONV4_OUT_W];  /* 128 * 4 * 2 = 1024 */
-    float fc1_out[FC1_OUT];  /* 256 */
+    if (ws == NULL)
+        return;
 
-    /* Conv1: (1, 76, 40) -> (16, 38, 20) */
-    conv_bn_relu_pool(
-        input, FT_NN_INPUT_HEIGHT, FT_NN_INPUT_WIDTH, 1,
-        CONV1_WEIGHT, CONV1_BIAS, CONV1_OUT_CH,
-        buf1, CONV1_OUT_H, CONV1_OUT_W);
+    free(ws->arena);
+    free(ws);
+}
 
-    /* Conv2: (16, 38, 20) -> (32, 19, 10) */
-    conv_bn_relu_pool(
-        buf1, CONV1_OUT_H, CONV1_OUT_W, CONV1_OUT_CH,
-        CONV2_WEIGHT, CONV2_BIAS, CONV2_OUT_CH,
-        buf2, CONV2_OUT_H, CONV2_OUT_W);
+/* Float layers conv2 .. fc2 of n images whose conv1 output is in ws->act[0] */
+static void forward_from_conv2(FtNNWorkspace *ws, int n, float *outputs)
+{
+    float *buf1 = ws->act[0], *buf2 = ws->act[1], *buf3 = ws->act[2], *buf4 = ws->act[3];
 
-    /* Conv3: (32, 19, 10) -> (64, 9, 5) */
-    conv_bn_relu_pool(
-        buf2, CONV2_OUT_H, CONV2_OUT_W, CONV2_OUT_CH,
-        CONV3_WEIGHT, CONV3_BIAS, CONV3_OUT_CH,
-        buf3, CONV3_OUT_H, CONV3_OUT_W);
+    conv_layer_forward(ws, 1, buf1, n, buf2);
+    conv_layer_forward(ws, 2, buf2, n, buf3);
+    conv_layer_forward(ws, 3, buf3, n, buf4);
 
-    /* Conv4: (64, 9, 5) -> (128, 4, 2) */
-    conv_bn_relu_pool(
-        buf3, CONV3_OUT_H, CONV3_OUT_W, CONV3_OUT_CH,
-        CONV4_WEIGHT, CONV4_BIAS, CONV4_OUT_CH,
-        buf4, CONV4_OUT_H, CONV4_OUT_W);
+    fc_forward(ws, 0, buf4, n, ws->fc1_out);
+    fc_forward(ws, 1, ws->fc1_out, n, outputs);
+}
 
-    /* FC1: 1024 -> 256 (with ReLU) */
-    fc_relu(buf4, FC1_IN, FC1_WEIGHT, FC1_BIAS, FC1_OUT, fc1_out);
+/* Embeddings of n <= ws->max_batch images */
+static void forward(FtNNWorkspace *ws, const float *inputs, int n, float *outputs)
+{
+    pthread_once(&prepack_once, prepack_weights);
 
-    /* FC2: 256 -> 64 (no activation) */
-    fc(fc1_out, FC1_OUT, FC2_WEIGHT, FC2_BIAS, FC2_OUT, output);
+    conv_layer_forward(ws, 0, inputs, n, ws->act[0]);
+    forward_from_conv2(ws, n, outputs);
 
     /* L2 normalize */
-    l2_normalize(output, FC2_OUT);
+    for (int b = 0; b < n; b++) {
+        l2_normalize(outputs + b * FC2_OUT, FC2_OUT);
+    }
+}
+
+void ft_nn_compute_embedding(FtNNWorkspace *ws, const float *input, float *output)
+{
+    ft_nn_compute_embeddings_batch(ws, input, 1, output);
+}
+
+void ft_nn_compute_embeddings_batch(FtNNWorkspace *ws, const float *inputs, int n, float *outputs)
+{
+    FtNNWorkspace *tmp = NULL;
+
+    if (n <= 0)
+        return;
+
+    if (ws == NULL) {
+        ws = tmp = ft_nn_workspace_new(n);
+        if (ws == NULL)
+            return;
+    }
+
+    for (int b = 0; b < n; b += ws->max_batch) {
+        int chunk = n - b < ws->max_batch ? n - b : ws->max_batch;
+        forward(ws, inputs + b * FT_NN_INPUT_SIZE, chunk, outputs + b * FT_NN_EMBEDDING_DIM);
+    }
+
+    ft_nn_workspace_free(tmp);
+}
+
+/*
+ * Whether pooling row or column p of conv1 reads the same inputs, padding
+ * included, in an image moved by d pixels along an axis of size pixels as
+ * row or column p - d / 2 does in the original.
+ */
+static int conv1_window_moves(int p, int d, int size)
+{
+    if (d % 2 != 0 || p - d / 2 < 0 || p - d / 2 >= size / 2)
+        return 0;
+
+    for (int r = p * 2 - 1; r <= p * 2 + 2; r++) {
+        if ((r >= 0 && r < size) != (r - d >= 0 && r - d < size))
+            return 0;
+    }
+    return 1;
+}
+
+/*
+ * conv1 output of image b of a chunk moved by (dx, dy): translated from
+ * ws->shift_base where the pooling window moves with the image, listed in
+ * ws->windows from *count on to be recomputed where it reaches the edge.
+ */
+static void conv1_translate(FtNNWorkspace *ws, int b, int dx, int dy, int *count)
+{
+    const int opix = CONV1_OUT_H * CONV1_OUT_W;
+    float *out = ws->act[0] + b * CONV1_OUT_CH * opix;
+    int offset = dy / 2 * CONV1_OUT_W + dx / 2;
+    int cols[CONV1_OUT_W];
+    int first = *count;
+
+    for (int pw = 0; pw < CONV1_OUT_W; pw++) {
+        cols[pw] = conv1_window_moves(pw, dx, FT_NN_INPUT_WIDTH);
+    }
+
+    for (int ph = 0; ph < CONV1_OUT_H; ph++) {
+        int row = conv1_window_moves(ph, dy, FT_NN_INPUT_HEIGHT);
+
+        for (int pw = 0; pw < CONV1_OUT_W; pw++) {
+            if (!row || !cols[pw])
+                ws->windows[(*count)++] = b * opix + ph * CONV1_OUT_W + pw;
+        }
+    }
+
+    if (*count - first == opix)
+        return;
+
+    /*
+     * Window w takes window w - offset of the base. Copying whole planes
+     * also wraps rows around at the sides, but only into windows on the
+     * list, which are overwritten.
+     */
+    for (int c = 0; c < CONV1_OUT_CH; c++) {
+        float *dst = out + c * opix, *src = ws->shift_base + c * opix;
+
+        if (offset >= 0)
+            memcpy(dst + offset, src, (opix - offset) * sizeof(float));
+        else
+            memcpy(dst, src - offset, (opix + offset) * sizeof(float));
+    }
+}
+
+void ft_nn_compute_shifted_embeddings(FtNNWorkspace *ws, const float *input, const float *shifted,
+                                      const int *shifts, int n, float *outputs)
+{
+    FtNNWorkspace *tmp = NULL;
+
+    if (n <= 0)
+        return;
+
+    /* The direct kernel has no per-window entry; run it in full */
+    if (conv_algo == FT_NN_CONV_DIRECT) {
+        ft_nn_compute_embeddings_batch(ws, shifted, n, outputs);
+        return;
+    }
+
+    if (ws == NULL) {
+        ws = tmp = ft_nn_workspace_new(n);
+        if (ws == NULL)
+            return;
+    }
+
+    pthread_once(&prepack_once, prepack_weights);
+    conv_layer_forward(ws, 0, input, 1, ws->shift_base);
+
+    for (int b = 0; b < n; b += ws->max_batch) {
+        int chunk = n - b < ws->max_batch ? n - b : ws->max_batch;
+        int count = 0;
+
+        for (int i = 0; i < chunk; i++) {
+            conv1_translate(ws, i, shifts[(b + i) * 2], shifts[(b + i) * 2 + 1], &count);
+        }
+        conv1_windows(ws, shifted + b * FT_NN_INPUT_SIZE, ws->windows, count, ws->act[0]);
+        forward_from_conv2(ws, chunk, outputs + b * FT_NN_EMBEDDING_DIM);
+
+        for (int i = 0; i < chunk; i++) {
+            l2_normalize(outputs + (b + i) * FT_NN_EMBEDDING_DIM, FC2_OUT);
+        }
+    }
+
+    ft_nn_workspace_free(tmp);
 }
 
 float ft_nn_embedding_distance(const float *emb1, const float *emb2)
 {
-    float sum = 0.0f;
-    for (int i = 0; i < FT_NN_EMBEDDING_DIM; i++) {
-        float diff = emb1[i] - emb2[i];
-        sum += diff * diff;
+    return sqrtf(ft_nn_kernels()->sq_distance(emb1, emb2, FT_NN_EMBEDDING_DIM));
+}
+
+void ft_nn_embedding_sq_distances(const float *matrix, int rows, const float *emb,
+                                  float *sq_dists)
+{
+    ft_nn_kernels()->dot_rows(matrix, rows, emb, FT_NN_EMBEDDING_DIM, sq_dists);
+
+    for (int r = 0; r < rows; r++) {
+        float d = 2.0f - 2.0f * sq_dists[r];
+        sq_dists[r] = d > 0.0f ? d : 0.0f;
     }
-    return sqrtf(sum);
 }
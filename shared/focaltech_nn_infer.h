@@ -1,4 +1,9 @@
-/* Auto-generated - DO NOT EDIT */
+/*
+ * FocalTech FT9362 NN inference
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
 #ifndef FOCALTECH_NN_INFER_H
 #define FOCALTECH_NN_INFER_H
 
@@ -10,13 +15,133 @@
 #define FT_NN_INPUT_SIZE (FT_NN_INPUT_HEIGHT * FT_NN_INPUT_WIDTH)
 #define FT_NN_EMBEDDING_DIM 64
 
+/* Max per-component difference between embeddings from any two conv paths */
+#define FT_NN_EMBEDDING_TOLERANCE 1e-5f
+
+/**
+ * Use the weights in a model file written by tools/focaltech_nn_export.c.
+ *
+ * The file is validated (format, shapes, checksum) and mapped read-only;
+ * its tensors, packed layouts included, are used in place and stay mapped
+ * for the life of the process. Call it before creating the first workspace:
+ * once inference has bound the weights, the compiled-in ones if the build
+ * has them, another model cannot be loaded. Loading again after a
+ * successful load does nothing.
+ *
+ * @param path Model file
+ * @return 0 on success, -EBUSY if weights are already in use, or another
+ *         negative errno (-ENOENT, -EINVAL for a malformed file, -EBADMSG
+ *         for a checksum mismatch, -ENOTSUP for an unknown version)
+ */
+int ft_nn_load_model(const char *path);
+
+/* Convolution implementations */
+typedef enum {
+    FT_NN_CONV_AUTO = 0,    /* per layer, the faster of GEMM and Winograd (default) */
+    FT_NN_CONV_GEMM,        /* im2col panels + cache-blocked GEMM */
+    FT_NN_CONV_WINOGRAD,    /* Winograd F(2x2,3x3) with pre-transformed filters */
+    FT_NN_CONV_DIRECT,      /* reference direct loop */
+} FtNNConvAlgo;
+
+/**
+ * Select the convolution implementation used by ft_nn_compute_embedding.
+ * Process-wide; set it before inference starts on any thread.
+ *
+ * @param algo Convolution implementation
+ */
+void ft_nn_set_conv_algo(FtNNConvAlgo algo);
+
+/**
+ * Get the convolution implementation currently in use.
+ *
+ * @return Convolution implementation
+ */
+FtNNConvAlgo ft_nn_get_conv_algo(void);
+
+/**
+ * Get the name of the SIMD kernel set selected for this CPU
+ * ("avx512", "avx2", "neon" or "scalar").
+ *
+ * @return Kernel set name
+ */
+const char *ft_nn_get_kernel_isa(void);
+
+/* Scratch memory for inference, see ft_nn_workspace_new */
+typedef struct _FtNNWorkspace FtNNWorkspace;
+
+/**
+ * Create an inference workspace.
+ *
+ * All activations and scratch buffers for batches of up to max_batch images
+ * are allocated here, 64-byte aligned, so inference with the workspace does
+ * not allocate. A workspace must only be used by one thread at a time;
+ * threads with their own workspaces can run inference concurrently.
+ *
+ * @param max_batch Largest batch passed in one call (larger batches are
+ *                  processed in chunks)
+ * @return New workspace, or NULL if out of memory or no model is loaded
+ *         and the build has no compiled-in weights
+ */
+FtNNWorkspace *ft_nn_workspace_new(int max_batch);
+
+/**
+ * Free an inference workspace.
+ *
+ * @param ws Workspace, may be NULL
+ */
+void ft_nn_workspace_free(FtNNWorkspace *ws);
+
 /**
  * Compute fingerprint embedding from preprocessed image.
  *
+ * @param ws Workspace, or NULL to allocate a temporary one for this call
  * @param input Preprocessed image as float array [76][40], values in [0, 1]
  * @param output Output embedding array [64], will be L2-normalized
  */
-void ft_nn_compute_embedding(const float *input, float *output);
+void ft_nn_compute_embedding(FtNNWorkspace *ws, const float *input, float *output);
+
+/**
+ * Compute embeddings for a batch of preprocessed images in one pass.
+ *
+ * Every weight block is streamed through cache once for the whole batch, so
+ * this is much cheaper than n calls to ft_nn_compute_embedding. Results
+ * agree with the single-image path to FT_NN_EMBEDDING_TOLERANCE.
+ *
+ * @param ws Workspace, or NULL to allocate a temporary one for this call
+ * @param inputs Preprocessed images, n consecutive float arrays [76][40]
+ * @param n Number of images
+ * @param outputs Output embeddings, n consecutive arrays [64], L2-normalized
+ */
+void ft_nn_compute_embeddings_batch(FtNNWorkspace *ws, const float *inputs, int n,
+                                    float *outputs);
+
+/* Offset of ft_nn_compute_shifted_embeddings() for an image that is no shift of the input */
+#define FT_NN_SHIFT_UNRELATED 1
+
+/**
+ * Compute embeddings for a batch of shifted copies of one image.
+ *
+ * shifted[i] is input moved by (shifts[2i], shifts[2i + 1]) pixels along x
+ * and y: shifted[i][y][x] == input[y - dy][x - dx] wherever both are inside
+ * the image. The pixels moved in from outside may hold anything, e.g. the
+ * clamped edge. conv1 of input is computed once; for every even shift its
+ * output is translated and only the pooling windows that reach the moved
+ * edge are recomputed from shifted[i]. Images with an odd offset, such as
+ * FT_NN_SHIFT_UNRELATED, go through conv1 in full, so any batch can be
+ * passed. The results are bit for bit those of
+ * ft_nn_compute_embeddings_batch on shifted. The direct path computes
+ * every image in full.
+ *
+ * @param ws Workspace, or NULL to allocate a temporary one for this call
+ * @param input Preprocessed image the shifts are taken of [76][40]
+ * @param shifted Preprocessed images, n consecutive float arrays [76][40]
+ * @param shifts (dx, dy) of each image, n consecutive pairs
+ * @param n Number of images
+ * @param outputs Output embeddings, n consecutive arrays [64], L2-normalized
+ */
+void ft_nn_compute_shifted_embeddings(FtNNWorkspace *ws, const float *input,
+                                      const float *shifted, const int *shifts, int n,
+                                      float *outputs);
 
 /**
  * Compute L2 distance between two embeddings.
@@ -27,4 +152,20 @@ void ft_nn_compute_embedding(const float *input, float *output);
  */
 float ft_nn_embedding_distance(const float *emb1, const float *emb2);
 
+/**
+ * Compute squared L2 distances from an embedding to a matrix of embeddings.
+ *
+ * All embeddings must be L2-normalized: each distance comes from a dot
+ * product as |a - b|^2 = 2 - 2 a.b (clamped at 0), with the whole matrix
+ * in one vectorized pass and no square roots. The results agree with
+ * ft_nn_embedding_distance squared to about 1e-6.
+ *
+ * @param matrix Embeddings, rows consecutive arrays [64], ideally 64-byte aligned
+ * @param rows Number of embeddings in matrix
+ * @param emb Embedding [64]
+ * @param sq_dists Output squared distances [rows]
+ */
+void ft_nn_embedding_sq_distances(const float *matrix, int rows, const float *emb,
+                                  float *sq_dists);
+
 #endif /* FOCALTECH_NN_INFER_H */
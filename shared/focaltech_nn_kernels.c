@@ -0,0 +1,700 @@
+/*
+ * FocalTech FT9362 NN compute kernels
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#include "focaltech_nn_kernels.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FT_NN_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__)
+#define FT_NN_NEON 1
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_ASIMD
+#define HWCAP_ASIMD (1 << 1)
+#endif
+#endif
+
+/*
+ * 3x3 median from sorted columns: the largest column minimum, the median
+ * of the column medians and the smallest column maximum have the window
+ * median as their median. Only MIN/MAX of whatever type T is, so every set
+ * selects the same element as a full sort of the window.
+ */
+#define SORT3(T, MIN, MAX, a, b, c) do { \
+    T t_ = MIN(a, b), u_ = MAX(a, b), v_ = MAX(t_, c); \
+    a = MIN(t_, c); \
+    b = MIN(u_, v_); \
+    c = MAX(u_, v_); \
+} while (0)
+
+#define MED3(MIN, MAX, a, b, c) MAX(MIN(a, b), MIN(MAX(a, b), c))
+
+#define MEDIAN3X3(T, LOAD, MIN, MAX, r0, r1, r2, m) do { \
+    T a0 = LOAD(r0), a1 = LOAD(r1), a2 = LOAD(r2); \
+    T b0 = LOAD((r0) + 1), b1 = LOAD((r1) + 1), b2 = LOAD((r2) + 1); \
+    T c0 = LOAD((r0) + 2), c1 = LOAD((r1) + 2), c2 = LOAD((r2) + 2); \
+    SORT3(T, MIN, MAX, a0, a1, a2); \
+    SORT3(T, MIN, MAX, b0, b1, b2); \
+    SORT3(T, MIN, MAX, c0, c1, c2); \
+    m = MED3(MIN, MAX, MAX(MAX(a0, b0), c0), MED3(MIN, MAX, a1, b1, c1), \
+             MIN(MIN(a2, b2), c2)); \
+} while (0)
+
+/* Scalar (reference) */
+
+static int scalar_supported(void)
+{
+    return 1;
+}
+
+static void gemm_scalar(int k, const float *a, const float *b, const float *bias, float *c)
+{
+    float acc[FT_NN_GEMM_NR][FT_NN_GEMM_MR];
+
+    for (int j = 0; j < FT_NN_GEMM_NR; j++) {
+        for (int i = 0; i < FT_NN_GEMM_MR; i++) {
+            acc[j][i] = bias[i];
+        }
+    }
+
+    for (int p = 0; p < k; p++) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+        const float *bp = b + p * FT_NN_GEMM_NR;
+        for (int j = 0; j < FT_NN_GEMM_NR; j++) {
+            for (int i = 0; i < FT_NN_GEMM_MR; i++) {
+                acc[j][i] += ap[i] * bp[j];
+            }
+        }
+    }
+
+    memcpy(c, acc, sizeof(acc));
+}
+
+static void gemv_scalar(int k, const float *a, const float *x, const float *bias, float *y)
+{
+    float acc[FT_NN_GEMM_MR];
+
+    for (int i = 0; i < FT_NN_GEMM_MR; i++) {
+        acc[i] = bias[i];
+    }
+
+    for (int p = 0; p < k; p++) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+        for (int i = 0; i < FT_NN_GEMM_MR; i++) {
+            acc[i] += ap[i] * x[p];
+        }
+    }
+
+    memcpy(y, acc, sizeof(acc));
+}
+
+static void l2_normalize_scalar(float *vec, int size)
+{
+    float norm = 0.0f;
+    for (int i = 0; i < size; i++) {
+        norm += vec[i] * vec[i];
+    }
+    norm = sqrtf(norm + 1e-8f);
+    for (int i = 0; i < size; i++) {
+        vec[i] /= norm;
+    }
+}
+
+static float sq_distance_scalar(const float *a, const float *b, int size)
+{
+    float sum = 0.0f;
+    for (int i = 0; i < size; i++) {
+        float diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+static void dot_rows_scalar(const float *m, int rows, const float *x, int size, float *out)
+{
+    for (int r = 0; r < rows; r++) {
+        const float *row = m + r * size;
+        float sum = 0.0f;
+        for (int i = 0; i < size; i++) {
+            sum += row[i] * x[i];
+        }
+        out[r] = sum;
+    }
+}
+
+#define LOAD_F(p) (*(p))
+#define MIN_F(a, b) ((a) < (b) ? (a) : (b))
+#define MAX_F(a, b) ((a) > (b) ? (a) : (b))
+
+static void median3x3_scalar(const float *r0, const float *r1, const float *r2, float *out, int n)
+{
+    for (int i = 0; i < n; i++) {
+        MEDIAN3X3(float, LOAD_F, MIN_F, MAX_F, r0 + i, r1 + i, r2 + i, out[i]);
+    }
+}
+
+static const FtNNKernels kernels_scalar = {
+    "scalar", scalar_supported,
+    gemm_scalar, gemv_scalar, l2_normalize_scalar, sq_distance_scalar,
+    dot_rows_scalar, median3x3_scalar,
+};
+
+#ifdef FT_NN_X86
+
+/* AVX2 + FMA */
+
+#define TARGET_AVX2 __attribute__((target("avx2,fma")))
+
+static int avx2_supported(void)
+{
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+TARGET_AVX2 static inline float hsum_avx2(__m256 v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+
+TARGET_AVX2 static void gemm_avx2(int k, const float *a, const float *b, const float *bias, float *c)
+{
+    __m256 bias_lo = _mm256_loadu_ps(bias);
+    __m256 bias_hi = _mm256_loadu_ps(bias + 8);
+    __m256 c0l = bias_lo, c0h = bias_hi, c1l = bias_lo, c1h = bias_hi;
+    __m256 c2l = bias_lo, c2h = bias_hi, c3l = bias_lo, c3h = bias_hi;
+
+    for (int p = 0; p < k; p++) {
+        __m256 al = _mm256_loadu_ps(a + p * FT_NN_GEMM_MR);
+        __m256 ah = _mm256_loadu_ps(a + p * FT_NN_GEMM_MR + 8);
+        const float *bp = b + p * FT_NN_GEMM_NR;
+        __m256 bj;
+
+        bj = _mm256_broadcast_ss(bp + 0);
+        c0l = _mm256_fmadd_ps(al, bj, c0l);
+        c0h = _mm256_fmadd_ps(ah, bj, c0h);
+        bj = _mm256_broadcast_ss(bp + 1);
+        c1l = _mm256_fmadd_ps(al, bj, c1l);
+        c1h = _mm256_fmadd_ps(ah, bj, c1h);
+        bj = _mm256_broadcast_ss(bp + 2);
+        c2l = _mm256_fmadd_ps(al, bj, c2l);
+        c2h = _mm256_fmadd_ps(ah, bj, c2h);
+        bj = _mm256_broadcast_ss(bp + 3);
+        c3l = _mm256_fmadd_ps(al, bj, c3l);
+        c3h = _mm256_fmadd_ps(ah, bj, c3h);
+    }
+
+    _mm256_storeu_ps(c + 0, c0l);
+    _mm256_storeu_ps(c + 8, c0h);
+    _mm256_storeu_ps(c + 16, c1l);
+    _mm256_storeu_ps(c + 24, c1h);
+    _mm256_storeu_ps(c + 32, c2l);
+    _mm256_storeu_ps(c + 40, c2h);
+    _mm256_storeu_ps(c + 48, c3l);
+    _mm256_storeu_ps(c + 56, c3h);
+}
+
+TARGET_AVX2 static void gemv_avx2(int k, const float *a, const float *x, const float *bias, float *y)
+{
+    /* Two accumulator pairs over even/odd k hide the FMA latency */
+    __m256 cl = _mm256_loadu_ps(bias), ch = _mm256_loadu_ps(bias + 8);
+    __m256 dl = _mm256_setzero_ps(), dh = _mm256_setzero_ps();
+    int p = 0;
+
+    for (; p + 2 <= k; p += 2) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+        __m256 x0 = _mm256_broadcast_ss(x + p);
+        __m256 x1 = _mm256_broadcast_ss(x + p + 1);
+
+        cl = _mm256_fmadd_ps(_mm256_loadu_ps(ap), x0, cl);
+        ch = _mm256_fmadd_ps(_mm256_loadu_ps(ap + 8), x0, ch);
+        dl = _mm256_fmadd_ps(_mm256_loadu_ps(ap + 16), x1, dl);
+        dh = _mm256_fmadd_ps(_mm256_loadu_ps(ap + 24), x1, dh);
+    }
+    if (p < k) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+        __m256 x0 = _mm256_broadcast_ss(x + p);
+
+        cl = _mm256_fmadd_ps(_mm256_loadu_ps(ap), x0, cl);
+        ch = _mm256_fmadd_ps(_mm256_loadu_ps(ap + 8), x0, ch);
+    }
+
+    _mm256_storeu_ps(y, _mm256_add_ps(cl, dl));
+    _mm256_storeu_ps(y + 8, _mm256_add_ps(ch, dh));
+}
+
+TARGET_AVX2 static void l2_normalize_avx2(float *vec, int size)
+{
+    __m256 s = _mm256_setzero_ps();
+    __m256 nv;
+    float norm;
+    int i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        __m256 v = _mm256_loadu_ps(vec + i);
+        s = _mm256_fmadd_ps(v, v, s);
+    }
+    norm = hsum_avx2(s);
+    for (; i < size; i++) {
+        norm += vec[i] * vec[i];
+    }
+    norm = sqrtf(norm + 1e-8f);
+
+    nv = _mm256_set1_ps(norm);
+    for (i = 0; i + 8 <= size; i += 8) {
+        _mm256_storeu_ps(vec + i, _mm256_div_ps(_mm256_loadu_ps(vec + i), nv));
+    }
+    for (; i < size; i++) {
+        vec[i] /= norm;
+    }
+}
+
+TARGET_AVX2 static float sq_distance_avx2(const float *a, const float *b, int size)
+{
+    __m256 s = _mm256_setzero_ps();
+    float sum;
+    int i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        __m256 d = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        s = _mm256_fmadd_ps(d, d, s);
+    }
+    sum = hsum_avx2(s);
+    for (; i < size; i++) {
+        float diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+TARGET_AVX2 static void dot_rows_avx2(const float *m, int rows, const float *x, int size, float *out)
+{
+    for (int r = 0; r < rows; r++) {
+        const float *row = m + r * size;
+        __m256 s = _mm256_setzero_ps();
+        float sum;
+        int i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            s = _mm256_fmadd_ps(_mm256_loadu_ps(row + i), _mm256_loadu_ps(x + i), s);
+        }
+        sum = hsum_avx2(s);
+        for (; i < size; i++) {
+            sum += row[i] * x[i];
+        }
+        out[r] = sum;
+    }
+}
+
+/* Eight pixels at a time; a short tail is redone by an overlapping last block */
+TARGET_AVX2 static void median3x3_avx2(const float *r0, const float *r1, const float *r2,
+                                       float *out, int n)
+{
+    if (n < 8) {
+        median3x3_scalar(r0, r1, r2, out, n);
+        return;
+    }
+
+    for (int i = 0;; i += 8) {
+        __m256 m;
+
+        if (i > n - 8) i = n - 8;
+        MEDIAN3X3(__m256, _mm256_loadu_ps, _mm256_min_ps, _mm256_max_ps,
+                  r0 + i, r1 + i, r2 + i, m);
+        _mm256_storeu_ps(out + i, m);
+        if (i == n - 8) break;
+    }
+}
+
+static const FtNNKernels kernels_avx2 = {
+    "avx2", avx2_supported,
+    gemm_avx2, gemv_avx2, l2_normalize_avx2, sq_distance_avx2,
+    dot_rows_avx2, median3x3_avx2,
+};
+
+/* AVX-512F */
+
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+
+static int avx512_supported(void)
+{
+    return __builtin_cpu_supports("avx512f");
+}
+
+TARGET_AVX512 static void gemm_avx512(int k, const float *a, const float *b, const float *bias, float *c)
+{
+    /* Two accumulator sets over even/odd k keep eight FMA chains in flight */
+    __m512 c0 = _mm512_loadu_ps(bias), c1 = c0, c2 = c0, c3 = c0;
+    __m512 d0 = _mm512_setzero_ps(), d1 = d0, d2 = d0, d3 = d0;
+    int p = 0;
+
+    for (; p + 2 <= k; p += 2) {
+        __m512 a0 = _mm512_loadu_ps(a + p * FT_NN_GEMM_MR);
+        __m512 a1 = _mm512_loadu_ps(a + (p + 1) * FT_NN_GEMM_MR);
+        const float *bp = b + p * FT_NN_GEMM_NR;
+
+        c0 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[0]), c0);
+        c1 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[1]), c1);
+        c2 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[2]), c2);
+        c3 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[3]), c3);
+        d0 = _mm512_fmadd_ps(a1, _mm512_set1_ps(bp[4]), d0);
+        d1 = _mm512_fmadd_ps(a1, _mm512_set1_ps(bp[5]), d1);
+        d2 = _mm512_fmadd_ps(a1, _mm512_set1_ps(bp[6]), d2);
+        d3 = _mm512_fmadd_ps(a1, _mm512_set1_ps(bp[7]), d3);
+    }
+    if (p < k) {
+        __m512 a0 = _mm512_loadu_ps(a + p * FT_NN_GEMM_MR);
+        const float *bp = b + p * FT_NN_GEMM_NR;
+
+        c0 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[0]), c0);
+        c1 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[1]), c1);
+        c2 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[2]), c2);
+        c3 = _mm512_fmadd_ps(a0, _mm512_set1_ps(bp[3]), c3);
+    }
+
+    _mm512_storeu_ps(c + 0, _mm512_add_ps(c0, d0));
+    _mm512_storeu_ps(c + 16, _mm512_add_ps(c1, d1));
+    _mm512_storeu_ps(c + 32, _mm512_add_ps(c2, d2));
+    _mm512_storeu_ps(c + 48, _mm512_add_ps(c3, d3));
+}
+
+TARGET_AVX512 static void gemv_avx512(int k, const float *a, const float *x, const float *bias, float *y)
+{
+    /* Four accumulators over k mod 4 hide the FMA latency */
+    __m512 c0 = _mm512_loadu_ps(bias);
+    __m512 c1 = _mm512_setzero_ps(), c2 = c1, c3 = c1;
+    int p = 0;
+
+    for (; p + 4 <= k; p += 4) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+
+        c0 = _mm512_fmadd_ps(_mm512_loadu_ps(ap), _mm512_set1_ps(x[p]), c0);
+        c1 = _mm512_fmadd_ps(_mm512_loadu_ps(ap + 16), _mm512_set1_ps(x[p + 1]), c1);
+        c2 = _mm512_fmadd_ps(_mm512_loadu_ps(ap + 32), _mm512_set1_ps(x[p + 2]), c2);
+        c3 = _mm512_fmadd_ps(_mm512_loadu_ps(ap + 48), _mm512_set1_ps(x[p + 3]), c3);
+    }
+    for (; p < k; p++) {
+        c0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + p * FT_NN_GEMM_MR), _mm512_set1_ps(x[p]), c0);
+    }
+
+    _mm512_storeu_ps(y, _mm512_add_ps(_mm512_add_ps(c0, c1), _mm512_add_ps(c2, c3)));
+}
+
+TARGET_AVX512 static void l2_normalize_avx512(float *vec, int size)
+{
+    __m512 s = _mm512_setzero_ps();
+    __m512 nv;
+    float norm;
+    int i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m512 v = _mm512_loadu_ps(vec + i);
+        s = _mm512_fmadd_ps(v, v, s);
+    }
+    norm = _mm512_reduce_add_ps(s);
+    for (; i < size; i++) {
+        norm += vec[i] * vec[i];
+    }
+    norm = sqrtf(norm + 1e-8f);
+
+    nv = _mm512_set1_ps(norm);
+    for (i = 0; i + 16 <= size; i += 16) {
+        _mm512_storeu_ps(vec + i, _mm512_div_ps(_mm512_loadu_ps(vec + i), nv));
+    }
+    for (; i < size; i++) {
+        vec[i] /= norm;
+    }
+}
+
+TARGET_AVX512 static float sq_distance_avx512(const float *a, const float *b, int size)
+{
+    __m512 s = _mm512_setzero_ps();
+    float sum;
+    int i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m512 d = _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i));
+        s = _mm512_fmadd_ps(d, d, s);
+    }
+    sum = _mm512_reduce_add_ps(s);
+    for (; i < size; i++) {
+        float diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+TARGET_AVX512 static void dot_rows_avx512(const float *m, int rows, const float *x, int size,
+                                          float *out)
+{
+    for (int r = 0; r < rows; r++) {
+        const float *row = m + r * size;
+        __m512 s = _mm512_setzero_ps();
+        float sum;
+        int i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            s = _mm512_fmadd_ps(_mm512_loadu_ps(row + i), _mm512_loadu_ps(x + i), s);
+        }
+        sum = _mm512_reduce_add_ps(s);
+        for (; i < size; i++) {
+            sum += row[i] * x[i];
+        }
+        out[r] = sum;
+    }
+}
+
+TARGET_AVX512 static void median3x3_avx512(const float *r0, const float *r1, const float *r2,
+                                           float *out, int n)
+{
+    if (n < 16) {
+        median3x3_avx2(r0, r1, r2, out, n);
+        return;
+    }
+
+    for (int i = 0;; i += 16) {
+        __m512 m;
+
+        if (i > n - 16) i = n - 16;
+        MEDIAN3X3(__m512, _mm512_loadu_ps, _mm512_min_ps, _mm512_max_ps,
+                  r0 + i, r1 + i, r2 + i, m);
+        _mm512_storeu_ps(out + i, m);
+        if (i == n - 16) break;
+    }
+}
+
+static const FtNNKernels kernels_avx512 = {
+    "avx512", avx512_supported,
+    gemm_avx512, gemv_avx512, l2_normalize_avx512, sq_distance_avx512,
+    dot_rows_avx512, median3x3_avx512,
+};
+
+#endif /* FT_NN_X86 */
+
+#ifdef FT_NN_NEON
+
+/* AArch64 Advanced SIMD */
+
+static int neon_supported(void)
+{
+    return (getauxval(AT_HWCAP) & HWCAP_ASIMD) != 0;
+}
+
+static void gemm_neon(int k, const float *a, const float *b, const float *bias, float *c)
+{
+    float32x4_t acc[FT_NN_GEMM_NR][4];
+
+    for (int j = 0; j < FT_NN_GEMM_NR; j++) {
+        for (int q = 0; q < 4; q++) {
+            acc[j][q] = vld1q_f32(bias + q * 4);
+        }
+    }
+
+    for (int p = 0; p < k; p++) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+        float32x4_t a0 = vld1q_f32(ap);
+        float32x4_t a1 = vld1q_f32(ap + 4);
+        float32x4_t a2 = vld1q_f32(ap + 8);
+        float32x4_t a3 = vld1q_f32(ap + 12);
+        float32x4_t bv = vld1q_f32(b + p * FT_NN_GEMM_NR);
+
+#define GEMM_NEON_COLUMN(j) \
+        acc[j][0] = vfmaq_laneq_f32(acc[j][0], a0, bv, j); \
+        acc[j][1] = vfmaq_laneq_f32(acc[j][1], a1, bv, j); \
+        acc[j][2] = vfmaq_laneq_f32(acc[j][2], a2, bv, j); \
+        acc[j][3] = vfmaq_laneq_f32(acc[j][3], a3, bv, j);
+
+        GEMM_NEON_COLUMN(0)
+        GEMM_NEON_COLUMN(1)
+        GEMM_NEON_COLUMN(2)
+        GEMM_NEON_COLUMN(3)
+#undef GEMM_NEON_COLUMN
+    }
+
+    for (int j = 0; j < FT_NN_GEMM_NR; j++) {
+        for (int q = 0; q < 4; q++) {
+            vst1q_f32(c + j * FT_NN_GEMM_MR + q * 4, acc[j][q]);
+        }
+    }
+}
+
+static void gemv_neon(int k, const float *a, const float *x, const float *bias, float *y)
+{
+    float32x4_t acc[2][4];
+    int p = 0;
+
+    for (int q = 0; q < 4; q++) {
+        acc[0][q] = vld1q_f32(bias + q * 4);
+        acc[1][q] = vdupq_n_f32(0.0f);
+    }
+
+    /* Two accumulator sets over even/odd k hide the FMA latency */
+    for (; p + 2 <= k; p += 2) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+        for (int q = 0; q < 4; q++) {
+            acc[0][q] = vfmaq_n_f32(acc[0][q], vld1q_f32(ap + q * 4), x[p]);
+            acc[1][q] = vfmaq_n_f32(acc[1][q], vld1q_f32(ap + FT_NN_GEMM_MR + q * 4), x[p + 1]);
+        }
+    }
+    if (p < k) {
+        const float *ap = a + p * FT_NN_GEMM_MR;
+        for (int q = 0; q < 4; q++) {
+            acc[0][q] = vfmaq_n_f32(acc[0][q], vld1q_f32(ap + q * 4), x[p]);
+        }
+    }
+
+    for (int q = 0; q < 4; q++) {
+        vst1q_f32(y + q * 4, vaddq_f32(acc[0][q], acc[1][q]));
+    }
+}
+
+static void l2_normalize_neon(float *vec, int size)
+{
+    float32x4_t s = vdupq_n_f32(0.0f);
+    float32x4_t nv;
+    float norm;
+    int i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        float32x4_t v = vld1q_f32(vec + i);
+        s = vfmaq_f32(s, v, v);
+    }
+    norm = vaddvq_f32(s);
+    for (; i < size; i++) {
+        norm += vec[i] * vec[i];
+    }
+    norm = sqrtf(norm + 1e-8f);
+
+    nv = vdupq_n_f32(norm);
+    for (i = 0; i + 4 <= size; i += 4) {
+        vst1q_f32(vec + i, vdivq_f32(vld1q_f32(vec + i), nv));
+    }
+    for (; i < size; i++) {
+        vec[i] /= norm;
+    }
+}
+
+static float sq_distance_neon(const float *a, const float *b, int size)
+{
+    float32x4_t s = vdupq_n_f32(0.0f);
+    float sum;
+    int i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        float32x4_t d = vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+        s = vfmaq_f32(s, d, d);
+    }
+    sum = vaddvq_f32(s);
+    for (; i < size; i++) {
+        float diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+static void dot_rows_neon(const float *m, int rows, const float *x, int size, float *out)
+{
+    for (int r = 0; r < rows; r++) {
+        const float *row = m + r * size;
+        float32x4_t s = vdupq_n_f32(0.0f);
+        float sum;
+        int i = 0;
+
+        for (; i + 4 <= size; i += 4) {
+            s = vfmaq_f32(s, vld1q_f32(row + i), vld1q_f32(x + i));
+        }
+        sum = vaddvq_f32(s);
+        for (; i < size; i++) {
+            sum += row[i] * x[i];
+        }
+        out[r] = sum;
+    }
+}
+
+static void median3x3_neon(const float *r0, const float *r1, const float *r2, float *out, int n)
+{
+    if (n < 4) {
+        median3x3_scalar(r0, r1, r2, out, n);
+        return;
+    }
+
+    for (int i = 0;; i += 4) {
+        float32x4_t m;
+
+        if (i > n - 4) i = n - 4;
+        MEDIAN3X3(float32x4_t, vld1q_f32, vminq_f32, vmaxq_f32, r0 + i, r1 + i, r2 + i, m);
+        vst1q_f32(out + i, m);
+        if (i == n - 4) break;
+    }
+}
+
+static const FtNNKernels kernels_neon = {
+    "neon", neon_supported,
+    gemm_neon, gemv_neon, l2_normalize_neon, sq_distance_neon,
+    dot_rows_neon, median3x3_neon,
+};
+
+#endif /* FT_NN_NEON */
+
+/* Dispatch */
+
+static const FtNNKernels *const kernel_sets[] = {
+#ifdef FT_NN_X86
+    &kernels_avx512,
+    &kernels_avx2,
+#endif
+#ifdef FT_NN_NEON
+    &kernels_neon,
+#endif
+    &kernels_scalar,
+    NULL,
+};
+
+static pthread_once_t select_once = PTHREAD_ONCE_INIT;
+static const FtNNKernels *selected = &kernels_scalar;
+static const FtNNKernels *forced;
+
+static void select_kernels(void)
+{
+    /* FT_NN_KERNELS=<name> caps the choice, e.g. "scalar" to debug a mismatch */
+    const char *want = getenv("FT_NN_KERNELS");
+
+    for (int i = 0; kernel_sets[i] != NULL; i++) {
+        if (want != NULL && strcmp(want, kernel_sets[i]->name) != 0)
+            continue;
+        if (kernel_sets[i]->supported()) {
+            selected = kernel_sets[i];
+            return;
+        }
+    }
+}
+
+const FtNNKernels *ft_nn_kernels(void)
+{
+    if (forced != NULL)
+        return forced;
+
+    pthread_once(&select_once, select_kernels);
+    return selected;
+}
+
+const FtNNKernels *const *ft_nn_kernels_all(void)
+{
+    return kernel_sets;
+}
+
+void ft_nn_kernels_force(const FtNNKernels *kernels)
+{
+    forced = kernels;
+}
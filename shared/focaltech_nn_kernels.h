@@ -0,0 +1,68 @@
+/*
+ * FocalTech FT9362 NN compute kernels
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#ifndef FOCALTECH_NN_KERNELS_H
+#define FOCALTECH_NN_KERNELS_H
+
+/* GEMM micro-tile: output channels x output pixels */
+#define FT_NN_GEMM_MR 16
+#define FT_NN_GEMM_NR 4
+
+/*
+ * One implementation of every inner loop of the network. The scalar set is
+ * the reference; the others are selected at first use from CPUID (x86) or
+ * HWCAP (aarch64) and agree with it to FT_NN_EMBEDDING_TOLERANCE.
+ */
+typedef struct {
+    const char *name;
+
+    /* Supported on the running CPU */
+    int (*supported)(void);
+
+    /*
+     * c[FT_NN_GEMM_NR][FT_NN_GEMM_MR] = bias + a^T * b, where a is a packed
+     * weight block [k][FT_NN_GEMM_MR] and b a micro-panel [k][FT_NN_GEMM_NR].
+     */
+    void (*gemm)(int k, const float *a, const float *b, const float *bias, float *c);
+
+    /* y[FT_NN_GEMM_MR] = bias + a^T * x for a packed weight block [k][FT_NN_GEMM_MR] */
+    void (*gemv)(int k, const float *a, const float *x, const float *bias, float *y);
+
+    /* vec /= sqrt(|vec|^2 + 1e-8) */
+    void (*l2_normalize)(float *vec, int size);
+
+    /* |a - b|^2 */
+    float (*sq_distance)(const float *a, const float *b, int size);
+
+    /* out[r] = m[r] . x for every row of a row-major matrix m [rows][size] */
+    void (*dot_rows)(const float *m, int rows, const float *x, int size, float *out);
+
+    /*
+     * out[i] = median of the 3x3 window on columns i..i+2 of rows r0, r1, r2,
+     * for i in [0, n). Exact: every set returns an element of the window.
+     */
+    void (*median3x3)(const float *r0, const float *r1, const float *r2, float *out, int n);
+} FtNNKernels;
+
+/**
+ * Get the fastest kernel set supported by the running CPU.
+ *
+ * Selected once per process on first call; safe to call from any thread.
+ */
+const FtNNKernels *ft_nn_kernels(void);
+
+/**
+ * Get the kernel sets compiled in, fastest first, NULL-terminated.
+ * Entries may be unsupported on the running CPU.
+ */
+const FtNNKernels *const *ft_nn_kernels_all(void);
+
+/**
+ * Force a kernel set (benchmarks and tests). NULL restores auto-selection.
+ */
+void ft_nn_kernels_force(const FtNNKernels *kernels);
+
+#endif /* FOCALTECH_NN_KERNELS_H */
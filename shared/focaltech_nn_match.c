@@ -9,10 +9,13 @@
 
 #include "focaltech_nn_match.h"
 #include "focaltech_nn_infer.h"
+#include "focaltech_nn_kernels.h"
+#include "focaltech_nn_tables.h"
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
 #include <float.h>
+#include <time.h>
 
 #ifndef G_PI
 #define G_PI 3.14159265358979323846
@@ -26,6 +29,272 @@
 #define ft_free(ptr)     free (ptr)
 #endif
 
+#define TTA_NUM_AUGMENTED FT_NN_TTA_NUM_AUGMENTED
+
+/* Pixels where the whole Gabor kernel lies inside the image */
+#define GABOR_VALID_H     (FT_NN_INPUT_HEIGHT - GABOR_KSIZE + 1)
+#define GABOR_VALID_W     (FT_NN_INPUT_WIDTH - GABOR_KSIZE + 1)
+
+/*
+ * Embeddings of recently seen images, keyed by a hash of the probe and the
+ * augmentation applied to it (0 for none), so identify does not re-embed
+ * the probe and its augmentations for every enrolled print. One verify
+ * needs 1 + TTA_NUM_AUGMENTED entries.
+ */
+#define EMBED_CACHE_SIZE 16
+
+/*
+ * Templates whose embeddings the engine gathers into its matrix without
+ * allocating; a print from the driver has 15. Larger prints grow it once.
+ */
+#define TEMPLATE_MATRIX_ROWS 16
+
+/*
+ * Filtered pixels are medians of int16 samples, so integers in the int16
+ * range. Streaming preprocessing histograms them into bins of
+ * 1 << STREAM_HIST_SHIFT values as rows are filtered.
+ */
+#define STREAM_HIST_SHIFT 4
+#define STREAM_HIST_BINS  (65536 >> STREAM_HIST_SHIFT)
+
+/*
+ * Everything the capture -> verify path needs, allocated once per device.
+ * The engine is 64-byte aligned and every array is a multiple of 16 floats,
+ * so each buffer starts on a cache line.
+ */
+#define ENGINE_ALIGN 64
+
+struct _FtNNEngine
+{
+  FtNNWorkspace *nn;
+
+  /* Preprocessing */
+  gfloat raw[FT_NN_INPUT_SIZE];
+  gfloat filtered[FT_NN_INPUT_SIZE];
+  gfloat scratch[FT_NN_INPUT_SIZE];
+
+  /* Quality */
+  gfloat img_norm[FT_NN_INPUT_SIZE];
+  gfloat orientation[FT_NN_INPUT_SIZE];
+  gfloat gabor_rows[2][FT_NN_INPUT_HEIGHT * GABOR_VALID_W];
+  gfloat gabor_resp[GABOR_NUM_ORIENT][GABOR_VALID_H * GABOR_VALID_W];
+
+  /* Verification */
+  gfloat tta_images[TTA_NUM_AUGMENTED * FT_NN_INPUT_SIZE];
+  gfloat tta_computed[TTA_NUM_AUGMENTED * FT_NN_EMBEDDING_DIM];
+
+  /*
+   * Embeddings of the templates being matched, one aligned row each, and
+   * their squared distances to the embedding last compared
+   */
+  gfloat *template_matrix;
+  gfloat *template_sq_dist;
+  gint template_capacity;
+
+  /* Embedding cache, least recently used entry replaced */
+  gfloat cache_embeddings[EMBED_CACHE_SIZE * FT_NN_EMBEDDING_DIM];
+
+  /* Quality contrast percentiles of the last ft_nn_process_raw output */
+  guint64 processed_hash;
+  gfloat processed_p2;
+  gfloat processed_p98;
+  gboolean processed_valid;
+
+  /* Last image that passed the quality gate */
+  guint64 quality_hash;
+  gboolean quality_valid;
+
+  guint64 cache_hash[EMBED_CACHE_SIZE];
+  guint cache_key[EMBED_CACHE_SIZE];     /* augmentation + 1, 0 if unused */
+  guint64 cache_used[EMBED_CACHE_SIZE];
+  guint64 cache_clock;
+  guint64 cache_hits;
+  guint64 cache_misses;
+
+  /* Streaming preprocessing: rows of raw and filtered done so far */
+  gint stream_converted;
+  gint stream_filtered;
+
+  /* Histogram of the filtered rows so far, and a bin -> slot map (-1) */
+  guint16 stream_hist[STREAM_HIST_BINS];
+  gint8 stream_slot[STREAM_HIST_BINS];
+
+  /* Probe of ft_nn_verify; last, as its size is not a multiple of 16 floats */
+  FtNNProbe probe;
+};
+
+/* Room for rows templates in the matrix; FALSE if out of memory */
+static gboolean
+template_matrix_reserve (FtNNEngine *engine, gint rows)
+{
+  void *mem;
+
+  if (rows <= engine->template_capacity)
+    return TRUE;
+
+  /* Distances after the matrix; rows is a multiple of 16 so both stay aligned */
+  rows = (rows + 15) & ~15;
+  if (posix_memalign (&mem, ENGINE_ALIGN,
+                      (gsize) rows * (FT_NN_EMBEDDING_DIM + 1) * sizeof (gfloat)) != 0)
+    return FALSE;
+
+  free (engine->template_matrix);
+  engine->template_matrix = (gfloat *) mem;
+  engine->template_sq_dist = engine->template_matrix + rows * FT_NN_EMBEDDING_DIM;
+  engine->template_capacity = rows;
+  return TRUE;
+}
+
+FtNNEngine *
+ft_nn_engine_new (void)
+{
+  void *mem;
+  FtNNEngine *engine;
+
+  if (posix_memalign (&mem, ENGINE_ALIGN, sizeof (FtNNEngine)) != 0)
+    return NULL;
+
+  engine = (FtNNEngine *) mem;
+  memset (engine, 0, sizeof (*engine));
+
+  memset (engine->stream_slot, -1, sizeof (engine->stream_slot));
+
+  engine->nn = ft_nn_workspace_new (TTA_NUM_AUGMENTED);
+  if (engine->nn == NULL || !template_matrix_reserve (engine, TEMPLATE_MATRIX_ROWS))
+    {
+      ft_nn_engine_free (engine);
+      return NULL;
+    }
+
+  return engine;
+}
+
+void
+ft_nn_engine_free (FtNNEngine *engine)
+{
+  if (engine == NULL)
+    return;
+
+  ft_nn_workspace_free (engine->nn);
+  free (engine->template_matrix);
+  free (engine);
+}
+
+/*
+ * 64-bit hash of a network input image: four multiply-rotate lanes over
+ * the raw float bits, then a final avalanche. A few microseconds, against
+ * hundreds for an embedding.
+ */
+static guint64
+hash_image (const gfloat *image)
+{
+  const guint64 prime1 = 0x9E3779B185EBCA87ULL;
+  const guint64 prime2 = 0xC2B2AE3D27D4EB4FULL;
+  guint64 lane[4] = { prime1, prime2, ~prime1, ~prime2 };
+  const unsigned char *p = (const unsigned char *) image;
+  guint64 word, h;
+  gsize i;
+  gint l;
+
+  G_STATIC_ASSERT (FT_NN_INPUT_SIZE * sizeof (gfloat) % 32 == 0);
+
+  for (i = 0; i < FT_NN_INPUT_SIZE * sizeof (gfloat); i += 32)
+    {
+      for (l = 0; l < 4; l++)
+        {
+          memcpy (&word, p + i + 8 * l, sizeof (word));
+          lane[l] += word * prime2;
+          lane[l] = (lane[l] << 31) | (lane[l] >> 33);
+          lane[l] *= prime1;
+        }
+    }
+
+  h = lane[0] ^ ((lane[1] << 7) | (lane[1] >> 57)) ^
+      ((lane[2] << 12) | (lane[2] >> 52)) ^ ((lane[3] << 18) | (lane[3] >> 46));
+  h ^= h >> 33;
+  h *= prime2;
+  h ^= h >> 29;
+  h *= prime1;
+  h ^= h >> 32;
+  return h;
+}
+
+/* Cache key of augmentation aug */
+static guint
+cache_key (gint aug)
+{
+  return (guint) aug + 1;
+}
+
+/* Copy the cached embedding of (hash, aug) to embedding; FALSE on a miss */
+static gboolean
+cache_lookup (FtNNEngine *engine, guint64 hash, gint aug, gfloat *embedding)
+{
+  guint key = cache_key (aug);
+  gint e;
+
+  for (e = 0; e < EMBED_CACHE_SIZE; e++)
+    {
+      if (engine->cache_key[e] == key && engine->cache_hash[e] == hash)
+        {
+          memcpy (embedding, engine->cache_embeddings + e * FT_NN_EMBEDDING_DIM,
+                  FT_NN_EMBEDDING_DIM * sizeof (gfloat));
+          engine->cache_used[e] = ++engine->cache_clock;
+          engine->cache_hits++;
+          return TRUE;
+        }
+    }
+
+  engine->cache_misses++;
+  return FALSE;
+}
+
+static void
+cache_insert (FtNNEngine *engine, guint64 hash, gint aug, const gfloat *embedding)
+{
+  gint e, victim = 0;
+
+  for (e = 1; e < EMBED_CACHE_SIZE; e++)
+    {
+      if (engine->cache_used[e] < engine->cache_used[victim])
+        victim = e;
+    }
+
+  memcpy (engine->cache_embeddings + victim * FT_NN_EMBEDDING_DIM, embedding,
+          FT_NN_EMBEDDING_DIM * sizeof (gfloat));
+  engine->cache_hash[victim] = hash;
+  engine->cache_key[victim] = cache_key (aug);
+  engine->cache_used[victim] = ++engine->cache_clock;
+}
+
+/* Embedding of the unaugmented image with the given hash, through the cache */
+static void
+embed_cached (FtNNEngine *engine, const gfloat *image, guint64 hash, gfloat *embedding)
+{
+  if (cache_lookup (engine, hash, 0, embedding))
+    return;
+
+  ft_nn_compute_embedding (engine->nn, image, embedding);
+  cache_insert (engine, hash, 0, embedding);
+}
+
+void
+ft_nn_engine_get_cache_stats (FtNNEngine *engine, guint64 *hits, guint64 *misses)
+{
+  if (hits)
+    *hits = engine->cache_hits;
+  if (misses)
+    *misses = engine->cache_misses;
+}
+
+void
+ft_nn_engine_clear_cache (FtNNEngine *engine)
+{
+  memset (engine->cache_key, 0, sizeof (engine->cache_key));
+  memset (engine->cache_used, 0, sizeof (engine->cache_used));
+  engine->cache_clock = 0;
+}
+
 void
 ft_nn_match_init (FtNNMatchContext *ctx)
 {
@@ -34,118 +303,311 @@ ft_nn_match_init (FtNNMatchContext *ctx)
   ctx->pixel_corr_threshold = 0.01f;
   ctx->tta_vote_threshold = 0.75f;
   ctx->min_agreeing_templates = 3;
+  ctx->identify_top_k = 0;
 
   ctx->use_orientation_check = TRUE;
   ctx->use_tta = TRUE;
   ctx->use_pixel_correlation = TRUE;
 }
 
-static gint
-float_compare (const void *a, const void *b)
+/* Quickselect: reorder arr[lo..hi] so that arr[k] is in its sorted place */
+static void
+select_nth (gfloat *arr, gint lo, gint hi, gint k)
 {
-  gfloat fa = *(const gfloat *)a;
-  gfloat fb = *(const gfloat *)b;
-  return (fa > fb) - (fa < fb);
-}
+  gfloat pivot, tmp;
+  gint i, j;
 
-static gfloat
-compute_percentile (const gfloat *arr, gint size, gfloat percentile)
-{
-  gfloat *sorted;
-  gfloat idx, frac, result;
-  gint lo, hi;
+  while (lo < hi)
+    {
+      /* Median of three, so sorted and constant runs stay linear */
+      gint mid = lo + (hi - lo) / 2;
+      gfloat a = arr[lo], b = arr[mid], c = arr[hi];
 
-  if (arr == NULL || size <= 0)
-    return 0.0f;
+      pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
 
-  sorted = (gfloat *) ft_malloc (size * sizeof (gfloat));
-  if (sorted == NULL)
-    return 0.0f;
+      i = lo;
+      j = hi;
+      while (i <= j)
+        {
+          while (arr[i] < pivot)
+            i++;
+          while (arr[j] > pivot)
+            j--;
+          if (i <= j)
+            {
+              tmp = arr[i];
+              arr[i] = arr[j];
+              arr[j] = tmp;
+              i++;
+              j--;
+            }
+        }
 
-  memcpy (sorted, arr, size * sizeof (gfloat));
-  qsort (sorted, size, sizeof (gfloat), float_compare);
+      if (k <= j)
+        hi = j;
+      else if (k >= i)
+        lo = i;
+      else
+        return;
+    }
+}
 
-  idx = (percentile / 100.0f) * (size - 1);
-  lo = (gint) idx;
-  hi = lo + 1;
-  if (hi >= size)
-    hi = size - 1;
+/*
+ * Order statistics of arr without sorting it: values[r] is the ranks[r]-th
+ * smallest element, ranks ascending. Each selection leaves everything past
+ * its rank no smaller, so the next one only searches the rest; the whole
+ * set costs a few linear passes. scratch: size floats.
+ */
+static void
+select_ranks (const gfloat *arr, gint size, const gint *ranks, gint n_ranks,
+              gfloat *values, gfloat *scratch)
+{
+  gint r, lo = 0;
 
-  frac = idx - lo;
-  result = sorted[lo] * (1 - frac) + sorted[hi] * frac;
+  memcpy (scratch, arr, size * sizeof (gfloat));
 
-  ft_free (sorted);
-  return result;
+  for (r = 0; r < n_ranks; r++)
+    {
+      select_nth (scratch, lo, size - 1, ranks[r]);
+      values[r] = scratch[ranks[r]];
+      lo = ranks[r];
+    }
 }
 
+/* Interpolated percentile from the sorted elements at lo and lo + 1 */
 static void
-median_filter_3x3 (const gfloat *input, gfloat *output, gint height, gint width)
+percentile_rank (gfloat percentile, gint size, gint *lo, gfloat *frac)
+{
+  gfloat idx = (percentile / 100.0f) * (size - 1);
+
+  *lo = (gint) idx;
+  *frac = idx - *lo;
+}
+
+/*
+ * Median of the in-bounds part of the 3x3 window at (y, x): the upper
+ * median (element count / 2 of the sorted window) of 4 or 6 pixels at the
+ * corners and edges.
+ */
+static gfloat
+median_at (const gfloat *input, gint height, gint width, gint y, gint x)
 {
-  gint y, x, dy, dx, ny, nx, count, i, j;
+  gint dy, dx, ny, nx, count = 0, i, j;
   gfloat window[9];
   gfloat tmp;
 
-  for (y = 0; y < height; y++)
+  for (dy = -1; dy <= 1; dy++)
     {
-      for (x = 0; x < width; x++)
+      for (dx = -1; dx <= 1; dx++)
         {
-          count = 0;
+          ny = y + dy;
+          nx = x + dx;
+          if (ny >= 0 && ny < height && nx >= 0 && nx < width)
+            window[count++] = input[ny * width + nx];
+        }
+    }
 
-          for (dy = -1; dy <= 1; dy++)
+  for (i = 0; i < count - 1; i++)
+    {
+      for (j = i + 1; j < count; j++)
+        {
+          if (window[j] < window[i])
             {
-              for (dx = -1; dx <= 1; dx++)
-                {
-                  ny = y + dy;
-                  nx = x + dx;
-                  if (ny >= 0 && ny < height && nx >= 0 && nx < width)
-                    window[count++] = input[ny * width + nx];
-                }
+              tmp = window[i];
+              window[i] = window[j];
+              window[j] = tmp;
             }
+        }
+    }
+  return window[count / 2];
+}
 
-          for (i = 0; i < count - 1; i++)
-            {
-              for (j = i + 1; j < count; j++)
-                {
-                  if (window[j] < window[i])
-                    {
-                      tmp = window[i];
-                      window[i] = window[j];
-                      window[j] = tmp;
-                    }
-                }
-            }
-          output[y * width + x] = window[count / 2];
+/*
+ * Row y of the 3x3 median filter; needs input rows y - 1 .. y + 1. Interior
+ * rows use the SIMD min/max network, the one-pixel border median_at().
+ */
+static void
+median_filter_row (const gfloat *input, gfloat *output, gint height, gint width, gint y)
+{
+  const gfloat *row = input + y * width;
+  gint x;
+
+  if (y == 0 || y == height - 1)
+    {
+      for (x = 0; x < width; x++)
+        output[y * width + x] = median_at (input, height, width, y, x);
+      return;
+    }
+
+  ft_nn_kernels ()->median3x3 (row - width, row, row + width, output + y * width + 1, width - 2);
+  output[y * width] = median_at (input, height, width, y, 0);
+  output[y * width + width - 1] = median_at (input, height, width, y, width - 1);
+}
+
+/* Ranks of the 2nd and 98th percentiles ft_nn_check_quality uses for contrast */
+#define QUALITY_P2_RANK   ((gint) (0.02f * FT_NN_INPUT_SIZE))
+#define QUALITY_P98_RANK  ((gint) (0.98f * FT_NN_INPUT_SIZE))
+
+static inline gfloat
+normalize_pixel (gfloat v, gfloat p5, gfloat range)
+{
+  gfloat val = (v - p5) / range;
+
+  if (val < 0.0f)
+    val = 0.0f;
+  if (val > 1.0f)
+    val = 1.0f;
+  return 1.0f - val;
+}
+
+/* The image is the second half of the frame's int16 pixels */
+#define RAW_IMAGE_OFFSET (FT_RAW_HEADER + FT_NN_INPUT_SIZE * sizeof (int16_t))
+
+static inline gint
+stream_bin (gfloat v)
+{
+  return ((gint) v + 32768) >> STREAM_HIST_SHIFT;
+}
+
+/*
+ * Order statistics of the filtered frame from the streaming histogram, as
+ * select_ranks() would return them: the cumulative counts locate the bin
+ * of every rank, then one pass over the frame counts the values inside
+ * just those bins. ranks ascending, at most 8.
+ */
+static void
+stream_select_ranks (FtNNEngine *engine, const gint *ranks, gint n_ranks, gfloat *values)
+{
+  const gfloat *filtered = engine->filtered;
+  guint16 fine[8][1 << STREAM_HIST_SHIFT];
+  gint bins[8], below[8], rank_slot[8];
+  gint n_bins = 0, seen = 0, bin = 0, r, i;
+
+  g_assert (n_ranks <= 8);
+
+  for (r = 0; r < n_ranks; r++)
+    {
+      while (seen + engine->stream_hist[bin] <= ranks[r])
+        seen += engine->stream_hist[bin++];
+      if (n_bins == 0 || bins[n_bins - 1] != bin)
+        {
+          bins[n_bins] = bin;
+          below[n_bins] = seen;
+          engine->stream_slot[bin] = n_bins++;
         }
+      rank_slot[r] = n_bins - 1;
+    }
+
+  memset (fine, 0, sizeof (fine));
+  for (i = 0; i < FT_NN_INPUT_SIZE; i++)
+    {
+      gint v = (gint) filtered[i] + 32768;
+      gint slot = engine->stream_slot[v >> STREAM_HIST_SHIFT];
+
+      if (slot >= 0)
+        fine[slot][v & ((1 << STREAM_HIST_SHIFT) - 1)]++;
     }
+
+  for (r = 0; r < n_ranks; r++)
+    {
+      gint slot = rank_slot[r], offset = 0;
+
+      seen = below[slot];
+      while (seen + fine[slot][offset] <= ranks[r])
+        seen += fine[slot][offset++];
+      values[r] = (gfloat) ((bins[slot] << STREAM_HIST_SHIFT) + offset - 32768);
+    }
+
+  for (i = 0; i < n_bins; i++)
+    engine->stream_slot[bins[i]] = -1;
 }
 
 void
-ft_nn_process_raw (const unsigned char *raw_data, gfloat *output)
+ft_nn_process_begin (FtNNEngine *engine)
 {
-  const int16_t *pixels = (const int16_t *) (raw_data + FT_RAW_HEADER);
-  gfloat temp[FT_NN_INPUT_HEIGHT * FT_NN_INPUT_WIDTH];
-  gfloat filtered[FT_NN_INPUT_HEIGHT * FT_NN_INPUT_WIDTH];
-  gfloat p5, p95, range, val;
-  gint i;
+  engine->stream_converted = 0;
+  engine->stream_filtered = 0;
+  memset (engine->stream_hist, 0, sizeof (engine->stream_hist));
+}
 
-  for (i = 0; i < FT_NN_INPUT_HEIGHT * FT_NN_INPUT_WIDTH; i++)
-    temp[i] = (gfloat) pixels[3040 + i];
+void
+ft_nn_process_feed (FtNNEngine *engine, const unsigned char *raw_data, size_t len)
+{
+  const int16_t *pixels = (const int16_t *) (raw_data + RAW_IMAGE_OFFSET);
+  const size_t row_bytes = FT_NN_INPUT_WIDTH * sizeof (int16_t);
+  gint rows, y, x;
 
-  median_filter_3x3 (temp, filtered, FT_NN_INPUT_HEIGHT, FT_NN_INPUT_WIDTH);
+  if (len < RAW_IMAGE_OFFSET)
+    return;
 
-  p5 = compute_percentile (filtered, FT_NN_INPUT_SIZE, 5.0f);
-  p95 = compute_percentile (filtered, FT_NN_INPUT_SIZE, 95.0f);
-  range = p95 - p5 + 1e-8f;
+  rows = (gint) MIN ((len - RAW_IMAGE_OFFSET) / row_bytes, (size_t) FT_NN_INPUT_HEIGHT);
 
-  for (i = 0; i < FT_NN_INPUT_SIZE; i++)
+  for (y = engine->stream_converted; y < rows; y++)
+    {
+      for (x = 0; x < FT_NN_INPUT_WIDTH; x++)
+        engine->raw[y * FT_NN_INPUT_WIDTH + x] = (gfloat) pixels[y * FT_NN_INPUT_WIDTH + x];
+    }
+  engine->stream_converted = MAX (engine->stream_converted, rows);
+
+  /* A row can be filtered once the one below it has arrived */
+  rows = engine->stream_converted == FT_NN_INPUT_HEIGHT ? FT_NN_INPUT_HEIGHT :
+         engine->stream_converted - 1;
+  for (y = engine->stream_filtered; y < rows; y++)
     {
-      val = (filtered[i] - p5) / range;
-      if (val < 0.0f)
-        val = 0.0f;
-      if (val > 1.0f)
-        val = 1.0f;
-      output[i] = 1.0f - val;
+      const gfloat *row = engine->filtered + y * FT_NN_INPUT_WIDTH;
+
+      median_filter_row (engine->raw, engine->filtered, FT_NN_INPUT_HEIGHT,
+                         FT_NN_INPUT_WIDTH, y);
+      for (x = 0; x < FT_NN_INPUT_WIDTH; x++)
+        engine->stream_hist[stream_bin (row[x])]++;
     }
+  engine->stream_filtered = MAX (engine->stream_filtered, rows);
+}
+
+void
+ft_nn_process_finish (FtNNEngine *engine, const unsigned char *raw_data, gfloat *output)
+{
+  gfloat *filtered = engine->filtered;
+  gint ranks[6], lo5, lo95;
+  gfloat values[6], frac5, frac95;
+  gfloat p5, p95, range;
+  gint i;
+
+  ft_nn_process_feed (engine, raw_data, RAW_IMAGE_OFFSET + FT_NN_INPUT_SIZE * sizeof (int16_t));
+
+  /*
+   * One selection pass for the interpolated p5 and p95 and for the quality
+   * percentiles: the output is a non-increasing function of filtered, so
+   * its k-th smallest value is that function of filtered's (n-1-k)-th.
+   */
+  percentile_rank (5.0f, FT_NN_INPUT_SIZE, &lo5, &frac5);
+  percentile_rank (95.0f, FT_NN_INPUT_SIZE, &lo95, &frac95);
+  ranks[0] = FT_NN_INPUT_SIZE - 1 - QUALITY_P98_RANK;
+  ranks[1] = lo5;
+  ranks[2] = lo5 + 1;
+  ranks[3] = lo95;
+  ranks[4] = lo95 + 1;
+  ranks[5] = FT_NN_INPUT_SIZE - 1 - QUALITY_P2_RANK;
+  stream_select_ranks (engine, ranks, 6, values);
+
+  p5 = values[1] * (1 - frac5) + values[2] * frac5;
+  p95 = values[3] * (1 - frac95) + values[4] * frac95;
+  range = p95 - p5 + 1e-8f;
+
+  for (i = 0; i < FT_NN_INPUT_SIZE; i++)
+    output[i] = normalize_pixel (filtered[i], p5, range);
+
+  engine->processed_p2 = normalize_pixel (values[5], p5, range);
+  engine->processed_p98 = normalize_pixel (values[0], p5, range);
+  engine->processed_hash = hash_image (output);
+  engine->processed_valid = TRUE;
+}
+
+void
+ft_nn_process_raw (FtNNEngine *engine, const unsigned char *raw_data, gfloat *output)
+{
+  ft_nn_process_begin (engine);
+  ft_nn_process_finish (engine, raw_data, output);
 }
 
 gfloat
@@ -195,37 +657,61 @@ ft_nn_orientation_diff (gfloat angle1, gfloat angle2)
   return diff;
 }
 
-gfloat
-ft_nn_compute_ncc (const gfloat *img1, const gfloat *img2)
+/* Mean and standard deviation of an image, as the NCC normalizes it */
+static void
+ncc_stats (const gfloat *img, gfloat *mean, gfloat *std)
 {
-  gfloat mean1 = 0.0f, mean2 = 0.0f;
-  gfloat std1 = 0.0f, std2 = 0.0f, corr = 0.0f;
-  gfloat d1, d2;
+  gfloat m = 0.0f, s = 0.0f, d;
   gint i;
 
+  for (i = 0; i < FT_NN_INPUT_SIZE; i++)
+    m += img[i];
+  m /= FT_NN_INPUT_SIZE;
+
   for (i = 0; i < FT_NN_INPUT_SIZE; i++)
     {
-      mean1 += img1[i];
-      mean2 += img2[i];
+      d = img[i] - m;
+      s += d * d;
     }
-  mean1 /= FT_NN_INPUT_SIZE;
+
+  *mean = m;
+  *std = sqrtf (s / FT_NN_INPUT_SIZE + 1e-8f);
+}
+
+/* NCC of img1, whose statistics are known, and img2 */
+static gfloat
+ncc_with_stats (const gfloat *img1, gfloat mean1, gfloat std1, const gfloat *img2)
+{
+  gfloat mean2 = 0.0f, std2 = 0.0f, corr = 0.0f;
+  gfloat d1, d2;
+  gint i;
+
+  for (i = 0; i < FT_NN_INPUT_SIZE; i++)
+    mean2 += img2[i];
   mean2 /= FT_NN_INPUT_SIZE;
 
   for (i = 0; i < FT_NN_INPUT_SIZE; i++)
     {
       d1 = img1[i] - mean1;
       d2 = img2[i] - mean2;
-      std1 += d1 * d1;
       std2 += d2 * d2;
       corr += d1 * d2;
     }
 
-  std1 = sqrtf (std1 / FT_NN_INPUT_SIZE + 1e-8f);
   std2 = sqrtf (std2 / FT_NN_INPUT_SIZE + 1e-8f);
 
   return corr / (FT_NN_INPUT_SIZE * std1 * std2);
 }
 
+gfloat
+ft_nn_compute_ncc (const gfloat *img1, const gfloat *img2)
+{
+  gfloat mean1, std1;
+
+  ncc_stats (img1, &mean1, &std1);
+  return ncc_with_stats (img1, mean1, std1, img2);
+}
+
 #define QUALITY_MIN_CONTRAST      0.5f
 #define QUALITY_MIN_VARIANCE      0.02f
 #define QUALITY_MIN_STD           0.10f
@@ -233,119 +719,263 @@ ft_nn_compute_ncc (const gfloat *img1, const gfloat *img2)
 #define QUALITY_MIN_GABOR         0.01f
 #define QUALITY_MIN_COHERENCE     0.0f
 
-#define GABOR_NUM_ORIENT  8
-#define GABOR_SIGMA       4.0f
-#define GABOR_WAVELENGTH  8.0f
-#define GABOR_KSIZE       17
+/*
+ * The Gabor stage first runs on every QUALITY_COARSE_STEP-th pixel. That
+ * grid holds every orientation the coherence blocks sample, so coherence
+ * from it matches the dense result to rounding; the dense pass only refines
+ * gabor strength, for frames that pass coherence with a coarse estimate
+ * within a factor of QUALITY_GABOR_MARGIN of the threshold.
+ */
+#define QUALITY_COHERENCE_BLOCK   8
+#define QUALITY_COARSE_STEP       4
+#define QUALITY_GABOR_MARGIN      4.0f
 
-static gfloat gabor_kernels[GABOR_NUM_ORIENT][GABOR_KSIZE * GABOR_KSIZE];
-static gfloat gabor_angles[GABOR_NUM_ORIENT];
+G_STATIC_ASSERT (QUALITY_COHERENCE_BLOCK % QUALITY_COARSE_STEP == 0);
 
-static gpointer
-init_gabor_kernels_impl (gpointer data)
-{
-  gint half = GABOR_KSIZE / 2;
-  gfloat freq = 1.0f / GABOR_WAVELENGTH;
-  gint o, ky, kx, i;
-  gfloat theta, sum_abs, x_theta, y_theta, gaussian, sinusoid, val;
+/*
+ * The Gaussian envelope is isotropic, so every Gabor kernel splits into two
+ * separable terms:
+ *   g(x) g(y) cos(a x + b y) = g(x) cos(a x) g(y) cos(b y) - g(x) sin(a x) g(y) sin(b y)
+ * with (a, b) = 2 pi f (cos theta, sin theta). Orientations theta and
+ * pi - theta differ only in the sign of a, so orientation pair p and
+ * GABOR_NUM_ORIENT - p share all four 1-D factors (gabor_hcos ... in
+ * focaltech_nn_tables.h).
+ */
 
-  (void) data;
+/*
+ * |Gabor response| of every orientation at every valid pixel, into
+ * engine->gabor_resp: per orientation pair a horizontal pass over all rows,
+ * then a vertical pass over the valid ones. About 450K multiply-adds
+ * against 3.3M for direct 17x17 filtering; agrees with it to float
+ * rounding.
+ */
+static void
+gabor_filter_bank (FtNNEngine *engine, const gfloat *img)
+{
+  gfloat *hc = engine->gabor_rows[0], *hs = engine->gabor_rows[1];
+  gint p, y, x, k;
 
-  for (o = 0; o < GABOR_NUM_ORIENT; o++)
+  for (p = 0; p < GABOR_NUM_PAIRS; p++)
     {
-      theta = (gfloat) o * G_PI / GABOR_NUM_ORIENT;
-      gabor_angles[o] = theta;
+      gint q = (GABOR_NUM_ORIENT - p) % GABOR_NUM_ORIENT;
 
-      sum_abs = 0.0f;
-      for (ky = -half; ky <= half; ky++)
+      for (y = 0; y < FT_NN_INPUT_HEIGHT; y++)
         {
-          for (kx = -half; kx <= half; kx++)
+          const gfloat *row = img + y * FT_NN_INPUT_WIDTH;
+          gfloat c[GABOR_VALID_W] = { 0 }, s[GABOR_VALID_W] = { 0 };
+
+          for (k = 0; k < GABOR_KSIZE; k++)
             {
-              x_theta = kx * cosf (theta) + ky * sinf (theta);
-              y_theta = -kx * sinf (theta) + ky * cosf (theta);
-              gaussian = expf (-(x_theta * x_theta + y_theta * y_theta) /
-                              (2 * GABOR_SIGMA * GABOR_SIGMA));
-              sinusoid = cosf (2 * G_PI * freq * x_theta);
-              val = gaussian * sinusoid;
-              gabor_kernels[o][(ky + half) * GABOR_KSIZE + (kx + half)] = val;
-              sum_abs += fabsf (val);
+              for (x = 0; x < GABOR_VALID_W; x++)
+                {
+                  c[x] += row[x + k] * gabor_hcos[p][k];
+                  s[x] += row[x + k] * gabor_hsin[p][k];
+                }
             }
+          memcpy (hc + y * GABOR_VALID_W, c, sizeof (c));
+          memcpy (hs + y * GABOR_VALID_W, s, sizeof (s));
         }
 
-      for (i = 0; i < GABOR_KSIZE * GABOR_KSIZE; i++)
-        gabor_kernels[o][i] /= (sum_abs + 1e-8f);
-    }
+      for (y = 0; y < GABOR_VALID_H; y++)
+        {
+          gfloat c[GABOR_VALID_W] = { 0 }, s[GABOR_VALID_W] = { 0 };
+          gfloat *resp_p = engine->gabor_resp[p] + y * GABOR_VALID_W;
+          gfloat *resp_q = engine->gabor_resp[q] + y * GABOR_VALID_W;
+
+          for (k = 0; k < GABOR_KSIZE; k++)
+            {
+              for (x = 0; x < GABOR_VALID_W; x++)
+                {
+                  c[x] += hc[(y + k) * GABOR_VALID_W + x] * gabor_vcos[p][k];
+                  s[x] += hs[(y + k) * GABOR_VALID_W + x] * gabor_vsin[p][k];
+                }
+            }
 
-  return NULL;
+          /* theta: c - s; pi - theta flips the sign of the sine term */
+          for (x = 0; x < GABOR_VALID_W; x++)
+            resp_p[x] = fabsf (c[x] - s[x]) * gabor_scale[p];
+          if (q != p && q != 0)
+            {
+              for (x = 0; x < GABOR_VALID_W; x++)
+                resp_q[x] = fabsf (c[x] + s[x]) * gabor_scale[q];
+            }
+        }
+    }
 }
 
+/*
+ * gabor_filter_bank() on every QUALITY_COARSE_STEP-th valid pixel in both
+ * directions only. The vertical pass runs first here, over whole rows, so
+ * it stays vectorizable; the horizontal pass then only visits the sampled
+ * columns. About 120K multiply-adds.
+ */
 static void
-init_gabor_kernels (void)
+gabor_filter_bank_coarse (FtNNEngine *engine, const gfloat *img)
 {
-  static GOnce gabor_init_once = G_ONCE_INIT;
-  g_once (&gabor_init_once, init_gabor_kernels_impl, NULL);
+  gint p, y, x, k;
+
+  for (p = 0; p < GABOR_NUM_PAIRS; p++)
+    {
+      gint q = (GABOR_NUM_ORIENT - p) % GABOR_NUM_ORIENT;
+
+      for (y = 0; y < GABOR_VALID_H; y += QUALITY_COARSE_STEP)
+        {
+          gfloat c[FT_NN_INPUT_WIDTH] = { 0 }, s[FT_NN_INPUT_WIDTH] = { 0 };
+          gfloat *resp_p = engine->gabor_resp[p] + y * GABOR_VALID_W;
+          gfloat *resp_q = engine->gabor_resp[q] + y * GABOR_VALID_W;
+
+          for (k = 0; k < GABOR_KSIZE; k++)
+            {
+              const gfloat *row = img + (y + k) * FT_NN_INPUT_WIDTH;
+
+              for (x = 0; x < FT_NN_INPUT_WIDTH; x++)
+                {
+                  c[x] += row[x] * gabor_vcos[p][k];
+                  s[x] += row[x] * gabor_vsin[p][k];
+                }
+            }
+
+          for (x = 0; x < GABOR_VALID_W; x += QUALITY_COARSE_STEP)
+            {
+              gfloat rc = 0.0f, rs = 0.0f;
+
+              for (k = 0; k < GABOR_KSIZE; k++)
+                {
+                  rc += c[x + k] * gabor_hcos[p][k];
+                  rs += s[x + k] * gabor_hsin[p][k];
+                }
+              resp_p[x] = fabsf (rc - rs) * gabor_scale[p];
+              if (q != p && q != 0)
+                resp_q[x] = fabsf (rc + rs) * gabor_scale[q];
+            }
+        }
+    }
 }
 
+/*
+ * Mean of the strongest Gabor response in engine->gabor_resp over every
+ * step-th valid pixel in both directions; orientation gets the angle of
+ * that response at each of them.
+ */
 static gfloat
-convolve_at (const gfloat *img, gint h, gint w, gint y, gint x,
-             const gfloat *kernel, gint ksize)
+gabor_strength (FtNNEngine *engine, gfloat *orientation, gint step)
 {
-  gint half = ksize / 2;
-  gfloat sum = 0.0f;
-  gint ky, kx, iy, ix;
+  const gint half = GABOR_KSIZE / 2;
+  gfloat sum = 0.0f, max_resp, resp;
+  gint y, x, o, max_orient, count = 0;
 
-  for (ky = -half; ky <= half; ky++)
+  for (y = 0; y < GABOR_VALID_H; y += step)
     {
-      for (kx = -half; kx <= half; kx++)
+      for (x = 0; x < GABOR_VALID_W; x += step)
         {
-          iy = y + ky;
-          ix = x + kx;
-          if (iy >= 0 && iy < h && ix >= 0 && ix < w)
-            sum += img[iy * w + ix] * kernel[(ky + half) * ksize + (kx + half)];
+          max_resp = 0.0f;
+          max_orient = 0;
+
+          for (o = 0; o < GABOR_NUM_ORIENT; o++)
+            {
+              resp = engine->gabor_resp[o][y * GABOR_VALID_W + x];
+              if (resp > max_resp)
+                {
+                  max_resp = resp;
+                  max_orient = o;
+                }
+            }
+
+          sum += max_resp;
+          count++;
+          orientation[(y + half) * FT_NN_INPUT_WIDTH + x + half] = gabor_angles[max_orient];
         }
     }
-  return sum;
+
+  return sum / count;
+}
+
+static guint64
+now_ns (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (guint64) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Time since *t, which moves on to now */
+static guint64
+lap_ns (guint64 *t)
+{
+  guint64 now = now_ns (), elapsed = now - *t;
+
+  *t = now;
+  return elapsed;
+}
+
+static gboolean
+quality_fail (FtNNQualityReport *report, FtNNQualityStage stage)
+{
+#ifdef FT_USE_GLIB
+  static const gchar *const names[FT_NN_QUALITY_N_STAGES] = {
+    "contrast", "variance", "std or center_ratio", "gabor", "coherence",
+  };
+
+  g_debug ("Quality FAIL: %s", names[stage]);
+#endif
+  report->passed = FALSE;
+  report->failed_stage = stage;
+  return FALSE;
 }
 
 gboolean
-ft_nn_check_quality (const gfloat *image)
+ft_nn_assess_quality (FtNNEngine *engine, const gfloat *image,
+                      FtNNQualityReport *report)
 {
   const gint h = FT_NN_INPUT_HEIGHT;
   const gint w = FT_NN_INPUT_WIDTH;
-  gfloat sorted[FT_NN_INPUT_SIZE];
   gfloat p2, p98, contrast_range;
   gfloat mean = 0.0f, variance = 0.0f, d;
-  gfloat cx, cy, sigma, range_val;
+  gfloat range_val;
   gfloat total_energy = 0.0f, weighted_energy = 0.0f;
   gfloat weighted_sum = 0.0f, weighted_sq_sum = 0.0f;
-  gfloat dx, dy, weight, val, stretched;
+  gfloat weight, val, stretched;
   gfloat center_ratio, mean_weighted, var_weighted, std_dev;
-  gfloat img_std, gabor_sum = 0.0f, gabor_strength;
+  gfloat img_std, gabor;
   gfloat coherence_sum = 0.0f, orient_coherence;
-  gfloat max_resp, resp, center_orient, local_coh, neighbor_orient;
-  gfloat img_norm[FT_NN_INPUT_SIZE];
-  gfloat *orientation;
-  gint i, y, x, N, gabor_count = 0, max_orient, o;
+  gfloat center_orient, local_coh, neighbor_orient;
+  gfloat *img_norm = engine->img_norm;
+  gfloat *orientation = engine->orientation;
+  gint i, y, x, N;
+  gboolean gabor_settled;
   gint block_size, coherence_count = 0, n_count;
   gint by, bx, ny, nx, n;
   gint neighbors[4][2];
+  guint64 t = now_ns (), image_hash = hash_image (image);
+
+  memset (report, 0, sizeof (*report));
+  engine->quality_valid = FALSE;
+
+  /* Usually image is the frame ft_nn_process_raw just produced */
+  if (engine->processed_valid && image_hash == engine->processed_hash)
+    {
+      p2 = engine->processed_p2;
+      p98 = engine->processed_p98;
+    }
+  else
+    {
+      static const gint ranks[2] = { QUALITY_P2_RANK, QUALITY_P98_RANK };
+      gfloat values[2];
 
-  memcpy (sorted, image, FT_NN_INPUT_SIZE * sizeof (gfloat));
-  qsort (sorted, FT_NN_INPUT_SIZE, sizeof (gfloat), float_compare);
-  p2 = sorted[(gint) (0.02f * FT_NN_INPUT_SIZE)];
-  p98 = sorted[(gint) (0.98f * FT_NN_INPUT_SIZE)];
+      select_ranks (image, FT_NN_INPUT_SIZE, ranks, 2, values, engine->scratch);
+      p2 = values[0];
+      p98 = values[1];
+    }
   contrast_range = p98 - p2;
+  report->contrast = contrast_range;
+  report->stage_ns[FT_NN_QUALITY_CONTRAST] = lap_ns (&t);
 
 #ifdef FT_USE_GLIB
   g_debug ("Quality: contrast=%.3f (min=%.3f)", contrast_range, QUALITY_MIN_CONTRAST);
 #endif
   if (contrast_range < QUALITY_MIN_CONTRAST)
-    {
-#ifdef FT_USE_GLIB
-      g_debug ("Quality FAIL: contrast");
-#endif
-      return FALSE;
-    }
+    return quality_fail (report, FT_NN_QUALITY_CONTRAST);
 
   for (i = 0; i < FT_NN_INPUT_SIZE; i++)
     mean += image[i];
@@ -357,21 +987,14 @@ ft_nn_check_quality (const gfloat *image)
       variance += d * d;
     }
   variance /= FT_NN_INPUT_SIZE;
+  report->variance = variance;
+  report->stage_ns[FT_NN_QUALITY_VARIANCE] = lap_ns (&t);
 
 #ifdef FT_USE_GLIB
   g_debug ("Quality: variance=%.4f (min=%.4f)", variance, QUALITY_MIN_VARIANCE);
 #endif
   if (variance < QUALITY_MIN_VARIANCE)
-    {
-#ifdef FT_USE_GLIB
-      g_debug ("Quality FAIL: variance");
-#endif
-      return FALSE;
-    }
-
-  cx = w / 2.0f;
-  cy = h / 2.0f;
-  sigma = (h < w ? h : w) / 3.0f;
+    return quality_fail (report, FT_NN_QUALITY_VARIANCE);
 
   range_val = (p98 - p2) > 1e-8f ? (p98 - p2) : 1.0f;
 
@@ -379,9 +1002,7 @@ ft_nn_check_quality (const gfloat *image)
     {
       for (x = 0; x < w; x++)
         {
-          dx = x - cx;
-          dy = y - cy;
-          weight = expf (-(dx * dx + dy * dy) / (2 * sigma * sigma));
+          weight = quality_center_weight[y * w + x];
 
           val = image[y * w + x];
           stretched = (val - p2) / range_val;
@@ -402,73 +1023,35 @@ ft_nn_check_quality (const gfloat *image)
   mean_weighted = weighted_sum / N;
   var_weighted = (weighted_sq_sum / N) - (mean_weighted * mean_weighted);
   std_dev = sqrtf (var_weighted > 0 ? var_weighted : 0);
+  report->std = std_dev;
+  report->center_ratio = center_ratio;
+  report->stage_ns[FT_NN_QUALITY_ENERGY] = lap_ns (&t);
 
 #ifdef FT_USE_GLIB
   g_debug ("Quality: std=%.3f (min=%.3f), center_ratio=%.3f (min=%.3f)",
            std_dev, QUALITY_MIN_STD, center_ratio, QUALITY_MIN_CENTER_RATIO);
 #endif
   if (std_dev < QUALITY_MIN_STD || center_ratio < QUALITY_MIN_CENTER_RATIO)
-    {
-#ifdef FT_USE_GLIB
-      g_debug ("Quality FAIL: std or center_ratio");
-#endif
-      return FALSE;
-    }
-
-  init_gabor_kernels ();
+    return quality_fail (report, FT_NN_QUALITY_ENERGY);
 
   img_std = sqrtf (variance);
   for (i = 0; i < FT_NN_INPUT_SIZE; i++)
     img_norm[i] = (image[i] - mean) / (img_std + 1e-8f);
 
-  orientation = (gfloat *) ft_malloc (FT_NN_INPUT_SIZE * sizeof (gfloat));
-  if (orientation == NULL)
-    {
-#ifdef FT_USE_GLIB
-      g_debug ("Quality FAIL: memory allocation failed");
-#endif
-      return FALSE;
-    }
-
-  for (y = GABOR_KSIZE / 2; y < h - GABOR_KSIZE / 2; y++)
-    {
-      for (x = GABOR_KSIZE / 2; x < w - GABOR_KSIZE / 2; x++)
-        {
-          max_resp = 0.0f;
-          max_orient = 0;
+  gabor_filter_bank_coarse (engine, img_norm);
+  gabor = gabor_strength (engine, orientation, QUALITY_COARSE_STEP);
+  gabor_settled = gabor < QUALITY_MIN_GABOR / QUALITY_GABOR_MARGIN ||
+                  gabor > QUALITY_MIN_GABOR * QUALITY_GABOR_MARGIN;
+  report->gabor = gabor;
+  report->stage_ns[FT_NN_QUALITY_GABOR] = lap_ns (&t);
 
-          for (o = 0; o < GABOR_NUM_ORIENT; o++)
-            {
-              resp = fabsf (convolve_at (img_norm, h, w, y, x,
-                                         gabor_kernels[o], GABOR_KSIZE));
-              if (resp > max_resp)
-                {
-                  max_resp = resp;
-                  max_orient = o;
-                }
-            }
-
-          gabor_sum += max_resp;
-          gabor_count++;
-          orientation[y * w + x] = gabor_angles[max_orient];
-        }
-    }
-
-  gabor_strength = (gabor_count > 0) ? (gabor_sum / gabor_count) : 0.0f;
-
-#ifdef FT_USE_GLIB
-  g_debug ("Quality: gabor=%.4f (min=%.4f)", gabor_strength, QUALITY_MIN_GABOR);
-#endif
-  if (gabor_strength < QUALITY_MIN_GABOR)
-    {
 #ifdef FT_USE_GLIB
-      g_debug ("Quality FAIL: gabor");
+  g_debug ("Quality: coarse gabor=%.4f (min=%.4f)", gabor, QUALITY_MIN_GABOR);
 #endif
-      ft_free (orientation);
-      return FALSE;
-    }
+  if (gabor_settled && gabor < QUALITY_MIN_GABOR)
+    return quality_fail (report, FT_NN_QUALITY_GABOR);
 
-  block_size = 8;
+  block_size = QUALITY_COHERENCE_BLOCK;
 
   for (by = block_size + GABOR_KSIZE / 2; by < h - block_size - GABOR_KSIZE / 2; by += block_size)
     {
@@ -504,218 +1087,307 @@ ft_nn_check_quality (const gfloat *image)
         }
     }
 
-  ft_free (orientation);
-
   orient_coherence = (coherence_count > 0) ? (coherence_sum / coherence_count) : 0.0f;
+  report->coherence = orient_coherence;
+  report->stage_ns[FT_NN_QUALITY_COHERENCE] = lap_ns (&t);
 
 #ifdef FT_USE_GLIB
   g_debug ("Quality: coherence=%.3f (min=%.3f)", orient_coherence, QUALITY_MIN_COHERENCE);
 #endif
   if (orient_coherence < QUALITY_MIN_COHERENCE)
+    return quality_fail (report, FT_NN_QUALITY_COHERENCE);
+
+  if (!gabor_settled)
     {
+      gabor_filter_bank (engine, img_norm);
+      gabor = gabor_strength (engine, orientation, 1);
+      report->gabor = gabor;
+      report->gabor_dense = TRUE;
+      report->stage_ns[FT_NN_QUALITY_GABOR] += lap_ns (&t);
+
 #ifdef FT_USE_GLIB
-      g_debug ("Quality FAIL: coherence");
+      g_debug ("Quality: gabor=%.4f (min=%.4f)", gabor, QUALITY_MIN_GABOR);
 #endif
-      return FALSE;
+      if (gabor < QUALITY_MIN_GABOR)
+        return quality_fail (report, FT_NN_QUALITY_GABOR);
     }
 
 #ifdef FT_USE_GLIB
   g_debug ("Quality PASS");
 #endif
+  report->passed = TRUE;
+  engine->quality_hash = image_hash;
+  engine->quality_valid = TRUE;
   return TRUE;
 }
 
 gboolean
-ft_nn_create_template (const gfloat *image, FtNNTemplate *tmpl)
+ft_nn_check_quality (FtNNEngine *engine, const gfloat *image)
+{
+  FtNNQualityReport report;
+
+  return ft_nn_assess_quality (engine, image, &report);
+}
+
+gboolean
+ft_nn_create_template (FtNNEngine *engine, const gfloat *image, FtNNTemplate *tmpl)
 {
-  if (!ft_nn_check_quality (image))
+  guint64 image_hash = hash_image (image);
+
+  /* The driver has usually just passed this capture through the gate */
+  if (!(engine->quality_valid && image_hash == engine->quality_hash) &&
+      !ft_nn_check_quality (engine, image))
     return FALSE;
 
-  ft_nn_compute_embedding (image, tmpl->embedding);
+  embed_cached (engine, image, image_hash, tmpl->embedding);
   memcpy (tmpl->image, image, FT_NN_INPUT_SIZE * sizeof (gfloat));
   tmpl->orientation = ft_nn_compute_orientation (image);
 
   return TRUE;
 }
 
+G_STATIC_ASSERT (TTA_NUM_REMAPS + 2 == TTA_NUM_AUGMENTED);
+
+/*
+ * TTA augmentations augs[0 .. n - 1] of the probe (0 .. TTA_NUM_AUGMENTED -
+ * 1: rotations, shifts, brightness), one after another in output as the
+ * network takes a batch, all in one sweep over the probe rows. Rotations
+ * and shifts gather through tta_remap; brightness offsets the pixel itself.
+ */
 static void
-rotate_image (const gfloat *input, gfloat *output, gfloat angle_deg)
+augment_batch (const gfloat *probe_image, const gint *augs, gint n, gfloat *output)
 {
-  gfloat angle_rad = angle_deg * (gfloat) G_PI / 180.0f;
-  gfloat cos_a = cosf (angle_rad);
-  gfloat sin_a = sinf (angle_rad);
-  gfloat cx = FT_NN_INPUT_WIDTH / 2.0f;
-  gfloat cy = FT_NN_INPUT_HEIGHT / 2.0f;
-  gfloat dx, dy, sx, sy;
-  gint y, x, ix, iy;
+  static const gfloat brightness[] = {-0.05f, 0.05f};
+  const unsigned short *maps[TTA_NUM_AUGMENTED];
+  gfloat deltas[TTA_NUM_AUGMENTED];
+  gint y, x, j;
 
-  for (y = 0; y < FT_NN_INPUT_HEIGHT; y++)
+  for (j = 0; j < n; j++)
     {
-      for (x = 0; x < FT_NN_INPUT_WIDTH; x++)
-        {
-          dx = x - cx;
-          dy = y - cy;
-          sx = dx * cos_a + dy * sin_a + cx;
-          sy = -dx * sin_a + dy * cos_a + cy;
+      maps[j] = augs[j] < TTA_NUM_REMAPS ? tta_remap[augs[j]] : NULL;
+      deltas[j] = augs[j] < TTA_NUM_REMAPS ? 0.0f : brightness[augs[j] - TTA_NUM_REMAPS];
+    }
+
+  for (y = 0; y < FT_NN_INPUT_SIZE; y += FT_NN_INPUT_WIDTH)
+    {
+      const gfloat *row = probe_image + y;
+      gfloat in[FT_NN_INPUT_WIDTH], out[FT_NN_INPUT_WIDTH];
 
-          ix = (gint) (sx + 0.5f);
-          iy = (gint) (sy + 0.5f);
+      memcpy (in, row, sizeof (in));
 
-          if (ix >= 0 && ix < FT_NN_INPUT_WIDTH && iy >= 0 && iy < FT_NN_INPUT_HEIGHT)
+      for (j = 0; j < n; j++)
+        {
+          if (maps[j] != NULL)
             {
-              output[y * FT_NN_INPUT_WIDTH + x] = input[iy * FT_NN_INPUT_WIDTH + ix];
+              for (x = 0; x < FT_NN_INPUT_WIDTH; x++)
+                out[x] = probe_image[maps[j][y + x]];
             }
           else
             {
-              ix = ix < 0 ? 0 : (ix >= FT_NN_INPUT_WIDTH ? FT_NN_INPUT_WIDTH - 1 : ix);
-              iy = iy < 0 ? 0 : (iy >= FT_NN_INPUT_HEIGHT ? FT_NN_INPUT_HEIGHT - 1 : iy);
-              output[y * FT_NN_INPUT_WIDTH + x] = input[iy * FT_NN_INPUT_WIDTH + ix];
+              for (x = 0; x < FT_NN_INPUT_WIDTH; x++)
+                out[x] = CLAMP (in[x] + deltas[j], 0.0f, 1.0f);
             }
+          memcpy (output + j * FT_NN_INPUT_SIZE + y, out, sizeof (out));
         }
     }
 }
 
+/*
+ * Embeddings of augmentations augs[0 .. n - 1] of the probe. With two or
+ * more shifts in the batch the network translates the probe's conv1 output
+ * for them instead of recomputing it; for a single shift computing the
+ * probe's conv1 would cost as much as it saves.
+ */
 static void
-shift_image (const gfloat *input, gfloat *output, gint dx, gint dy)
+embed_augmentations (FtNNEngine *engine, const gfloat *probe_image,
+                     const gint *augs, gint n, gfloat *output)
 {
-  gint y, x, sx, sy;
+  gint shifts[TTA_NUM_AUGMENTED][2];
+  gint j, s, n_shifts = 0;
 
-  for (y = 0; y < FT_NN_INPUT_HEIGHT; y++)
+  augment_batch (probe_image, augs, n, engine->tta_images);
+
+  for (j = 0; j < n; j++)
     {
-      for (x = 0; x < FT_NN_INPUT_WIDTH; x++)
+      s = augs[j] - TTA_NUM_ROTATIONS;
+      if (s >= 0 && s < TTA_NUM_SHIFTS)
+        {
+          shifts[j][0] = tta_shifts[s][0];
+          shifts[j][1] = tta_shifts[s][1];
+          n_shifts++;
+        }
+      else
         {
-          sx = x - dx;
-          sy = y - dy;
-
-          if (sx < 0)
-            sx = 0;
-          if (sx >= FT_NN_INPUT_WIDTH)
-            sx = FT_NN_INPUT_WIDTH - 1;
-          if (sy < 0)
-            sy = 0;
-          if (sy >= FT_NN_INPUT_HEIGHT)
-            sy = FT_NN_INPUT_HEIGHT - 1;
-
-          output[y * FT_NN_INPUT_WIDTH + x] = input[sy * FT_NN_INPUT_WIDTH + sx];
+          shifts[j][0] = shifts[j][1] = FT_NN_SHIFT_UNRELATED;
         }
     }
+
+  if (n_shifts >= 2)
+    ft_nn_compute_shifted_embeddings (engine->nn, probe_image, engine->tta_images,
+                                      &shifts[0][0], n, output);
+  else
+    ft_nn_compute_embeddings_batch (engine->nn, engine->tta_images, n, output);
 }
 
-static void
-adjust_brightness (const gfloat *input, gfloat *output, gfloat delta)
+/*
+ * Squared distances from embedding to the num_templates gathered by
+ * ft_nn_verify, in engine->template_sq_dist.
+ */
+static const gfloat *
+template_sq_distances (FtNNEngine *engine, const gfloat *embedding, gint num_templates)
 {
-  gint i;
-  gfloat val;
-
-  for (i = 0; i < FT_NN_INPUT_SIZE; i++)
-    {
-      val = input[i] + delta;
-      if (val < 0.0f)
-        val = 0.0f;
-      if (val > 1.0f)
-        val = 1.0f;
-      output[i] = val;
-    }
+  ft_nn_embedding_sq_distances (engine->template_matrix, num_templates, embedding,
+                                engine->template_sq_dist);
+  return engine->template_sq_dist;
 }
 
-static gint
-compute_tta_votes (const gfloat *probe_image, const FtNNTemplate *templates,
-                   gint num_templates, gfloat threshold)
+static gboolean
+tta_vote (FtNNEngine *engine, const gfloat *embedding, gint num_templates,
+          gfloat threshold_sq)
 {
-  static const gfloat rotations[] = {-10.0f, -5.0f, 5.0f, 10.0f};
-  static const gint shifts[][2] = {{-2, 0}, {2, 0}, {0, -2}, {0, 2}};
-  static const gfloat brightness[] = {-0.05f, 0.05f};
-
-  gfloat augmented[FT_NN_INPUT_SIZE];
-  gfloat embedding[FT_NN_EMBEDDING_DIM];
-  gint total_votes = 0;
-  gint t, r, s, b;
-  gfloat dist;
+  const gfloat *sq_dist = template_sq_distances (engine, embedding, num_templates);
+  gint t;
 
-  ft_nn_compute_embedding (probe_image, embedding);
   for (t = 0; t < num_templates; t++)
     {
-      dist = ft_nn_embedding_distance (embedding, templates[t].embedding);
-      if (dist < threshold)
-        {
-          total_votes++;
-          break;
-        }
+      if (sq_dist[t] < threshold_sq)
+        return TRUE;
     }
+  return FALSE;
+}
 
-  for (r = 0; r < 4; r++)
-    {
-      rotate_image (probe_image, augmented, rotations[r]);
-      ft_nn_compute_embedding (augmented, embedding);
+/*
+ * Augmentations least likely to agree with a template first (the larger
+ * rotations), so an impostor runs out of possible votes early; a genuine
+ * probe needs the same number of hits in any order.
+ */
+static const gint tta_order[TTA_NUM_AUGMENTED] = { 0, 3, 1, 2, 4, 5, 6, 7, 8, 9 };
 
-      for (t = 0; t < num_templates; t++)
-        {
-          dist = ft_nn_embedding_distance (embedding, templates[t].embedding);
-          if (dist < threshold)
-            {
-              total_votes++;
-              break;
-            }
-        }
-    }
+G_STATIC_ASSERT (TTA_NUM_AUGMENTED <= 32);
+
+/*
+ * Counts the probe and its augmentations that come within threshold of a
+ * template, stopping once votes_needed is reached or out of reach.
+ * Augmentations already in the probe or the cache are counted first; the
+ * rest are embedded in batches no larger than the number of votes that
+ * could still decide the outcome, and kept in the probe. Sets tta_votes,
+ * tta_evaluated and tta_computed of result.
+ */
+static void
+compute_tta_votes (FtNNEngine *engine, FtNNProbe *probe, gint num_templates,
+                   gfloat threshold_sq, gint votes_needed,
+                   FtNNMatchResult *result)
+{
+  gfloat *computed = engine->tta_computed;
+  gint pending[TTA_NUM_AUGMENTED];
+  gint votes = 0, remaining = TTA_NUM_AUGMENTED, n_pending = 0, next = 0;
+  gint n, i, a;
 
-  for (s = 0; s < 4; s++)
+  /* The unaugmented probe was already embedded by the caller */
+  if (tta_vote (engine, probe->embedding, num_templates, threshold_sq))
+    votes++;
+
+  /* Augmentations embedded for an earlier print or probe come for free */
+  for (i = 0; i < TTA_NUM_AUGMENTED; i++)
     {
-      shift_image (probe_image, augmented, shifts[s][0], shifts[s][1]);
-      ft_nn_compute_embedding (augmented, embedding);
+      a = tta_order[i];
+      if (votes >= votes_needed || votes + remaining < votes_needed)
+        break;
 
-      for (t = 0; t < num_templates; t++)
+      if (!(probe->tta_embedded & (1u << a)))
         {
-          dist = ft_nn_embedding_distance (embedding, templates[t].embedding);
-          if (dist < threshold)
+          if (!cache_lookup (engine, probe->hash, a + 1, probe->tta_embeddings[a]))
             {
-              total_votes++;
-              break;
+              pending[n_pending++] = a;
+              continue;
             }
+          probe->tta_embedded |= 1u << a;
         }
+
+      if (tta_vote (engine, probe->tta_embeddings[a], num_templates, threshold_sq))
+        votes++;
+      remaining--;
+      result->tta_evaluated++;
     }
 
-  for (b = 0; b < 2; b++)
+  while (next < n_pending && votes < votes_needed && votes + remaining >= votes_needed)
     {
-      adjust_brightness (probe_image, augmented, brightness[b]);
-      ft_nn_compute_embedding (augmented, embedding);
+      /* Enough to reach votes_needed, or to make it unreachable */
+      n = MIN (votes_needed - votes, remaining - (votes_needed - votes) + 1);
+      n = MIN (n, n_pending - next);
 
-      for (t = 0; t < num_templates; t++)
+      embed_augmentations (engine, probe->image, pending + next, n, computed);
+
+      for (i = 0; i < n; i++)
         {
-          dist = ft_nn_embedding_distance (embedding, templates[t].embedding);
-          if (dist < threshold)
-            {
-              total_votes++;
-              break;
-            }
+          const gfloat *e = computed + i * FT_NN_EMBEDDING_DIM;
+
+          a = pending[next + i];
+          memcpy (probe->tta_embeddings[a], e, FT_NN_EMBEDDING_DIM * sizeof (gfloat));
+          probe->tta_embedded |= 1u << a;
+          cache_insert (engine, probe->hash, a + 1, e);
+          if (tta_vote (engine, e, num_templates, threshold_sq))
+            votes++;
         }
+      next += n;
+      remaining -= n;
+      result->tta_evaluated += n;
+      result->tta_computed += n;
     }
 
-  return total_votes;
+  result->tta_votes = votes;
 }
 
-gboolean
-ft_nn_verify (const FtNNMatchContext *ctx, const gfloat *probe_image,
-              const FtNNTemplate *templates, gint num_templates,
-              FtNNMatchResult *result)
+void
+ft_nn_probe_init (FtNNProbe *probe, const gfloat *image)
+{
+  memcpy (probe->image, image, sizeof (probe->image));
+  probe->hash = hash_image (image);
+  probe->orientation = ft_nn_compute_orientation (image);
+  ncc_stats (image, &probe->mean, &probe->std);
+  probe->embedded = FALSE;
+  probe->tta_embedded = 0;
+}
+
+/* Gather the template embeddings into the engine's matrix; FALSE if out of memory */
+static gboolean
+gather_templates (FtNNEngine *engine, const FtNNTemplate *templates, gint num_templates)
 {
-  gfloat probe_embedding[FT_NN_EMBEDDING_DIM];
-  gfloat dist, diff, tta_ratio;
   gint t;
 
-  if (ctx == NULL || probe_image == NULL || result == NULL)
+  if (!template_matrix_reserve (engine, num_templates))
     return FALSE;
+  for (t = 0; t < num_templates; t++)
+    memcpy (engine->template_matrix + t * FT_NN_EMBEDDING_DIM, templates[t].embedding,
+            FT_NN_EMBEDDING_DIM * sizeof (gfloat));
+  return TRUE;
+}
+
+/*
+ * The cheap stages of verification: orientation gate, probe embedding
+ * distances and the number of agreeing templates. Fills result and leaves
+ * the templates gathered; FALSE if the print is rejected.
+ */
+static gboolean
+verify_embedding (FtNNEngine *engine, const FtNNMatchContext *ctx,
+                  FtNNProbe *probe,
+                  const FtNNTemplate *templates, gint num_templates,
+                  FtNNMatchResult *result)
+{
+  const gfloat *sq_dist;
+  gfloat best_sq, threshold_sq, diff;
+  gint t;
 
   memset (result, 0, sizeof (*result));
   result->matched = FALSE;
   result->best_distance = FLT_MAX;
   result->best_template_idx = -1;
-  result->tta_total = 11;
+  result->tta_total = TTA_NUM_AUGMENTED + 1;
 
   if (num_templates == 0 || templates == NULL)
     return FALSE;
 
-  result->probe_orientation = ft_nn_compute_orientation (probe_image);
+  result->probe_orientation = probe->orientation;
   result->min_orientation_diff = FLT_MAX;
 
   if (ctx->use_orientation_check)
@@ -732,32 +1404,67 @@ ft_nn_verify (const FtNNMatchContext *ctx, const gfloat *probe_image,
         return FALSE;
     }
 
-  ft_nn_compute_embedding (probe_image, probe_embedding);
+  /* One matrix of the template embeddings for the probe and every TTA vote */
+  if (!gather_templates (engine, templates, num_templates))
+    return FALSE;
 
-  for (t = 0; t < num_templates; t++)
+  if (!probe->embedded)
     {
-      dist = ft_nn_embedding_distance (probe_embedding, templates[t].embedding);
+      embed_cached (engine, probe->image, probe->hash, probe->embedding);
+      probe->embedded = TRUE;
+    }
+
+  /* Distances are compared squared; only the best one is rooted */
+  threshold_sq = ctx->nn_threshold * ctx->nn_threshold;
+  sq_dist = template_sq_distances (engine, probe->embedding, num_templates);
+  best_sq = FLT_MAX;
 
-      if (dist < result->best_distance)
+  for (t = 0; t < num_templates; t++)
+    {
+      if (sq_dist[t] < best_sq)
         {
-          result->best_distance = dist;
+          best_sq = sq_dist[t];
           result->best_template_idx = t;
         }
 
-      if (dist < ctx->nn_threshold)
+      if (sq_dist[t] < threshold_sq)
         result->templates_below_threshold++;
     }
+  result->best_distance = sqrtf (best_sq);
 
-  if (result->best_distance >= ctx->nn_threshold)
+  if (best_sq >= threshold_sq)
     return FALSE;
 
   if (result->templates_below_threshold < ctx->min_agreeing_templates)
     return FALSE;
 
+  return TRUE;
+}
+
+/*
+ * The expensive stages, TTA voting and pixel correlation, for a print that
+ * passed verify_embedding and whose templates are gathered
+ */
+static gboolean
+verify_tta_ncc (FtNNEngine *engine, const FtNNMatchContext *ctx,
+                FtNNProbe *probe,
+                const FtNNTemplate *templates, gint num_templates,
+                FtNNMatchResult *result)
+{
+  gfloat tta_ratio;
+  gint votes_needed;
+
   if (ctx->use_tta)
     {
-      result->tta_votes = compute_tta_votes (probe_image, templates,
-                                             num_templates, ctx->nn_threshold);
+      /* Fewest votes that meet the ratio, tta_total + 1 if none does */
+      for (votes_needed = 0; votes_needed <= result->tta_total; votes_needed++)
+        {
+          if ((gfloat) votes_needed / result->tta_total >= ctx->tta_vote_threshold)
+            break;
+        }
+
+      compute_tta_votes (engine, probe, num_templates,
+                         ctx->nn_threshold * ctx->nn_threshold, votes_needed, result);
 
       tta_ratio = (gfloat) result->tta_votes / result->tta_total;
       if (tta_ratio < ctx->tta_vote_threshold)
@@ -770,8 +1477,8 @@ ft_nn_verify (const FtNNMatchContext *ctx, const gfloat *probe_image,
 
   if (ctx->use_pixel_correlation && result->best_template_idx >= 0)
     {
-      result->best_ncc = ft_nn_compute_ncc (probe_image,
-                                            templates[result->best_template_idx].image);
+      result->best_ncc = ncc_with_stats (probe->image, probe->mean, probe->std,
+                                         templates[result->best_template_idx].image);
 
       if (result->best_ncc < ctx->pixel_corr_threshold)
         return FALSE;
@@ -785,6 +1492,97 @@ ft_nn_verify (const FtNNMatchContext *ctx, const gfloat *probe_image,
   return TRUE;
 }
 
+gboolean
+ft_nn_verify_probe (FtNNEngine *engine, const FtNNMatchContext *ctx,
+                    FtNNProbe *probe,
+                    const FtNNTemplate *templates, gint num_templates,
+                    FtNNMatchResult *result)
+{
+  if (engine == NULL || ctx == NULL || probe == NULL || result == NULL)
+    return FALSE;
+
+  return verify_embedding (engine, ctx, probe, templates, num_templates, result) &&
+         verify_tta_ncc (engine, ctx, probe, templates, num_templates, result);
+}
+
+/*
+ * Whether print a ranks before print b: smaller best distance, then the
+ * lower index, as the first of equally close prints wins exhaustively
+ */
+static gboolean
+identify_ranks_before (const FtNNMatchResult *results, gint a, gint b)
+{
+  if (results[a].best_distance != results[b].best_distance)
+    return results[a].best_distance < results[b].best_distance;
+  return a < b;
+}
+
+gint
+ft_nn_identify (FtNNEngine *engine, const FtNNMatchContext *ctx,
+                FtNNProbe *probe,
+                const FtNNTemplate *const *prints, const gint *num_templates,
+                gint num_prints, FtNNMatchResult *results)
+{
+  gint p, k, next, found = -1;
+
+  if (engine == NULL || ctx == NULL || probe == NULL || prints == NULL ||
+      num_templates == NULL || results == NULL)
+    return -1;
+
+  /* Coarse phase; matched marks the candidates until the full phase */
+  for (p = 0; p < num_prints; p++)
+    results[p].matched = verify_embedding (engine, ctx, probe, prints[p],
+                                           num_templates[p], &results[p]);
+
+  /*
+   * Full phase on the candidates in rank order. Of the prints that pass,
+   * the one with the smallest best distance is the first to pass, so
+   * stopping there gives the exhaustive answer whenever it ranks in the
+   * first identify_top_k.
+   */
+  for (k = 0; ctx->identify_top_k <= 0 || k < ctx->identify_top_k; k++)
+    {
+      next = -1;
+      for (p = 0; p < num_prints; p++)
+        {
+          if (results[p].matched && (next < 0 || identify_ranks_before (results, p, next)))
+            next = p;
+        }
+      if (next < 0)
+        break;
+
+      results[next].matched = FALSE;
+      if (gather_templates (engine, prints[next], num_templates[next]) &&
+          verify_tta_ncc (engine, ctx, probe, prints[next], num_templates[next],
+                          &results[next]))
+        {
+          found = next;
+          break;
+        }
+    }
+
+  /* Candidates left over were not verified */
+  for (p = 0; p < num_prints; p++)
+    {
+      if (p != found)
+        results[p].matched = FALSE;
+    }
+  return found;
+}
+
+gboolean
+ft_nn_verify (FtNNEngine *engine, const FtNNMatchContext *ctx,
+              const gfloat *probe_image,
+              const FtNNTemplate *templates, gint num_templates,
+              FtNNMatchResult *result)
+{
+  if (engine == NULL || probe_image == NULL)
+    return FALSE;
+
+  ft_nn_probe_init (&engine->probe, probe_image);
+  return ft_nn_verify_probe (engine, ctx, &engine->probe, templates, num_templates, result);
+}
+
 size_t
 ft_nn_template_serialize (const FtNNTemplate *tmpl, unsigned char *buffer)
 {
@@ -24,6 +24,9 @@ typedef int gboolean;
 /* Raw sensor data constants */
 #define FT_RAW_HEADER   6
 
+/* Test-time augmentations voted on besides the probe itself */
+#define FT_NN_TTA_NUM_AUGMENTED 10
+
 typedef struct {
   gfloat embedding[FT_NN_EMBEDDING_DIM];
   gfloat image[FT_NN_INPUT_SIZE];
@@ -36,6 +39,7 @@ typedef struct {
   gfloat pixel_corr_threshold;
   gfloat tta_vote_threshold;
   gint min_agreeing_templates;
+  gint identify_top_k;            /* prints ft_nn_identify fully verifies, 0 for all (default) */
 
   gboolean use_orientation_check;
   gboolean use_tta;
@@ -47,16 +51,105 @@ typedef struct {
   gfloat best_distance;
   gint best_template_idx;
   gint templates_below_threshold;
-  gint tta_votes;
+  gint tta_votes;                 /* counted until the outcome was decided */
   gint tta_total;
+  gint tta_evaluated;             /* augmentations voted on, of tta_total - 1 */
+  gint tta_computed;              /* of those, embedded rather than cached */
   gfloat best_ncc;
   gfloat probe_orientation;
   gfloat min_orientation_diff;
 } FtNNMatchResult;
 
+/*
+ * Everything verification derives from the probe alone, so matching one
+ * capture against several prints computes it once. ft_nn_probe_init sets
+ * the image and the cheap statistics; the embedding and the TTA embeddings
+ * are computed the first time a verification needs them and kept for the
+ * next. Treat the fields as read-only.
+ */
+typedef struct {
+  gfloat image[FT_NN_INPUT_SIZE];
+  guint64 hash;
+  gfloat orientation;
+  gfloat mean;                    /* NCC statistics of image */
+  gfloat std;
+  gboolean embedded;
+  gfloat embedding[FT_NN_EMBEDDING_DIM];
+  guint tta_embedded;             /* bit a set: tta_embeddings[a] is valid */
+  gfloat tta_embeddings[FT_NN_TTA_NUM_AUGMENTED][FT_NN_EMBEDDING_DIM];
+} FtNNProbe;
+
+/* Quality gate stages, in the order ft_nn_assess_quality runs them */
+typedef enum {
+  FT_NN_QUALITY_CONTRAST,   /* p98 - p2 */
+  FT_NN_QUALITY_VARIANCE,
+  FT_NN_QUALITY_ENERGY,     /* std and center_ratio of the stretched image */
+  FT_NN_QUALITY_GABOR,
+  FT_NN_QUALITY_COHERENCE,
+  FT_NN_QUALITY_N_STAGES,
+} FtNNQualityStage;
+
+/*
+ * Metrics of every stage that ran; the gate stops at the first failing
+ * stage, and the metrics of the stages after it stay 0. gabor is a coarse
+ * estimate unless gabor_dense is set, which happens only near its
+ * threshold.
+ */
+typedef struct {
+  gboolean passed;
+  FtNNQualityStage failed_stage;   /* when !passed */
+  gfloat contrast;
+  gfloat variance;
+  gfloat std;
+  gfloat center_ratio;
+  gfloat gabor;
+  gboolean gabor_dense;
+  gfloat coherence;
+  guint64 stage_ns[FT_NN_QUALITY_N_STAGES];
+} FtNNQualityReport;
+
+/*
+ * Preallocated buffers for preprocessing, quality and inference. Create one
+ * per device (or per thread): with an engine the capture -> verify path does
+ * not allocate, and engines on different threads run concurrently.
+ */
+typedef struct _FtNNEngine FtNNEngine;
+
+FtNNEngine *ft_nn_engine_new (void);
+
+void ft_nn_engine_free (FtNNEngine *engine);
+
+/*
+ * Each engine caches the embeddings of the last few probes and their TTA
+ * augmentations, keyed by a 64-bit hash of the image, so matching one
+ * capture against several prints embeds it once. Counters are cumulative
+ * over the engine's lifetime; either pointer may be NULL.
+ */
+void ft_nn_engine_get_cache_stats (FtNNEngine *engine, guint64 *hits,
+                                   guint64 *misses);
+
+void ft_nn_engine_clear_cache (FtNNEngine *engine);
+
 void ft_nn_match_init (FtNNMatchContext *ctx);
 
-void ft_nn_process_raw (const unsigned char *raw_data, gfloat *output);
+void ft_nn_process_raw (FtNNEngine *engine, const unsigned char *raw_data,
+                        gfloat *output);
+
+/*
+ * Incremental ft_nn_process_raw, to overlap preprocessing with the USB
+ * transfer: begin when a capture starts, feed the frame buffer whenever
+ * more of it has arrived (len bytes from its start), and finish with the
+ * complete frame. Conversion and median filtering happen in feed as rows
+ * become available; finish does whatever is left plus the normalization.
+ * The result is identical to ft_nn_process_raw.
+ */
+void ft_nn_process_begin (FtNNEngine *engine);
+
+void ft_nn_process_feed (FtNNEngine *engine, const unsigned char *raw_data,
+                         size_t len);
+
+void ft_nn_process_finish (FtNNEngine *engine, const unsigned char *raw_data,
+                           gfloat *output);
 
 gfloat ft_nn_compute_orientation (const gfloat *image);
 
@@ -64,14 +157,59 @@ gfloat ft_nn_orientation_diff (gfloat angle1, gfloat angle2);
 
 gfloat ft_nn_compute_ncc (const gfloat *img1, const gfloat *img2);
 
-gboolean ft_nn_check_quality (const gfloat *image);
+gboolean ft_nn_check_quality (FtNNEngine *engine, const gfloat *image);
+
+/*
+ * ft_nn_check_quality with the metrics and per-stage times in report. The
+ * engine remembers the last image that passed, so ft_nn_create_template
+ * does not check it again.
+ */
+gboolean ft_nn_assess_quality (FtNNEngine *engine, const gfloat *image,
+                               FtNNQualityReport *report);
 
-gboolean ft_nn_create_template (const gfloat *image, FtNNTemplate *tmpl);
+gboolean ft_nn_create_template (FtNNEngine *engine, const gfloat *image,
+                                FtNNTemplate *tmpl);
 
-gboolean ft_nn_verify (const FtNNMatchContext *ctx, const gfloat *probe_image,
+gboolean ft_nn_verify (FtNNEngine *engine, const FtNNMatchContext *ctx,
+                       const gfloat *probe_image,
                        const FtNNTemplate *templates, gint num_templates,
                        FtNNMatchResult *result);
 
+void ft_nn_probe_init (FtNNProbe *probe, const gfloat *image);
+
+/*
+ * ft_nn_verify of a probe from ft_nn_probe_init. Identify calls it once per
+ * enrolled print with the same probe: past the first print only template
+ * distances and the embeddings no earlier print needed are computed.
+ */
+gboolean ft_nn_verify_probe (FtNNEngine *engine, const FtNNMatchContext *ctx,
+                             FtNNProbe *probe,
+                             const FtNNTemplate *templates, gint num_templates,
+                             FtNNMatchResult *result);
+
+/*
+ * Match a probe against num_prints enrolled prints, print p being
+ * prints[p][0 .. num_templates[p] - 1]. Every print first goes through the
+ * cheap stages only (orientation, embedding distance, agreeing templates);
+ * the survivors are ranked by best distance, ties going to the lower
+ * index, and TTA and pixel correlation run on them in that order, stopping
+ * at the first that matches. The answer is the print that calling
+ * ft_nn_verify_probe on every print and keeping the first match with the
+ * smallest best_distance would give.
+ *
+ * A nonzero ctx->identify_top_k fully verifies at most that many
+ * survivors. It bounds the cost, but a matching print ranked identify_top_k
+ * + 1 or lower is missed when none above it passes; the default 0 keeps
+ * every survivor. results[p] holds the result of each print, with only the
+ * stages it reached; matched is set for the returned print alone.
+ *
+ * Returns the index of the matching print, or -1.
+ */
+gint ft_nn_identify (FtNNEngine *engine, const FtNNMatchContext *ctx,
+                     FtNNProbe *probe,
+                     const FtNNTemplate *const *prints, const gint *num_templates,
+                     gint num_prints, FtNNMatchResult *results);
+
 size_t ft_nn_template_serialize (const FtNNTemplate *tmpl, unsigned char *buffer);
 
 size_t ft_nn_template_deserialize (const unsigned char *buffer, size_t size,
@@ -0,0 +1,60 @@
+/*
+ * FocalTech FT9362 NN model file format
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * A model file is an FtNNModelHeader followed by the weight tensors of the
+ * embedding network, written by tools/focaltech_nn_export.c and mapped
+ * read-only by ft_nn_load_model(). Every tensor starts at a multiple of
+ * alignment from the start of the file, so the kernels use the mapping in
+ * place and every process shares one page-cache copy. Besides the plain
+ * PyTorch tensors the file carries the GEMM and Winograd packings, so
+ * nothing is repacked at load. All integers are little-endian.
+ */
+
+#ifndef FOCALTECH_NN_MODEL_H
+#define FOCALTECH_NN_MODEL_H
+
+#include <stdint.h>
+
+#define FT_NN_MODEL_MAGIC "FTNNMODL"
+#define FT_NN_MODEL_VERSION 1
+#define FT_NN_MODEL_ALIGN 64
+#define FT_NN_MODEL_MAX_TENSORS 32
+
+/* Element types */
+typedef enum {
+    FT_NN_MODEL_F32 = 1,
+} FtNNModelDtype;
+
+/* Tensor layouts */
+typedef enum {
+    FT_NN_MODEL_PLAIN = 0,     /* conv [out][in][3][3], FC [out][in], bias [out] */
+    FT_NN_MODEL_GEMM,          /* [out / gemm_mr][in * 9 or in][gemm_mr] */
+    FT_NN_MODEL_WINOGRAD,      /* [16][out / gemm_mr][in][gemm_mr], U = G g G^T */
+} FtNNModelLayout;
+
+typedef struct {
+    char name[16];             /* "conv1.weight", "conv1.gemm", "fc2.bias", ... */
+    uint32_t layout;           /* FtNNModelLayout */
+    uint32_t ndim;
+    uint32_t dims[4];          /* logical shape, unused dims 0 */
+    uint64_t offset;           /* bytes from the start of the file */
+    uint64_t size;             /* bytes */
+} FtNNModelTensor;
+
+typedef struct {
+    char magic[8];             /* FT_NN_MODEL_MAGIC, not NUL-terminated */
+    uint32_t version;          /* FT_NN_MODEL_VERSION */
+    uint32_t header_size;      /* sizeof(FtNNModelHeader) */
+    uint32_t dtype;            /* FtNNModelDtype of every tensor */
+    uint32_t alignment;        /* of every tensor offset, multiple of FT_NN_MODEL_ALIGN */
+    uint32_t gemm_mr;          /* block height of the packed layouts */
+    uint32_t n_tensors;
+    uint64_t file_size;
+    uint32_t checksum;         /* CRC-32 of the file with this field zeroed */
+    uint32_t reserved;
+    FtNNModelTensor tensors[FT_NN_MODEL_MAX_TENSORS];
+} FtNNModelHeader;
+
+#endif /* FOCALTECH_NN_MODEL_H */
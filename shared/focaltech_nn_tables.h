@@ -0,0 +1,2710 @@
+/* Auto-generated by tools/focaltech_nn_gentables.c - DO NOT EDIT */
+/* Gabor sigma 4, wavelength 8; TTA rotations -10 -5 5 10 degrees; TTA shifts (-2, 0) (2, 0) (0, -2) (0, 2) */
+
+#ifndef FOCALTECH_NN_TABLES_H
+#define FOCALTECH_NN_TABLES_H
+
+#define GABOR_NUM_ORIENT  8
+#define GABOR_KSIZE       17
+#define GABOR_NUM_PAIRS   5
+#define TTA_NUM_ROTATIONS 4
+#define TTA_NUM_SHIFTS    4
+#define TTA_NUM_REMAPS    8
+
+/* Orientation o is at o * pi / GABOR_NUM_ORIENT */
+static const float gabor_angles[GABOR_NUM_ORIENT] = {
+  0.0f, 0.392699093f, 0.785398185f, 1.17809725f, 1.57079637f, 1.96349537f,
+  2.3561945f, 2.7488935f,
+};
+
+/* 1 / sum |kernel| of each full 2-D kernel */
+static const float gabor_scale[GABOR_NUM_ORIENT] = {
+  0.01755712f, 0.0167195238f, 0.016706612f, 0.0167195238f, 0.0175571218f, 0.0167195257f,
+  0.0167066138f, 0.0167195257f,
+};
+
+/* Horizontal and vertical factors of orientation pair p and GABOR_NUM_ORIENT - p */
+static const float gabor_hcos[GABOR_NUM_PAIRS][GABOR_KSIZE] = {
+  {
+    0.135335281f, 0.152922541f, 3.87144183e-09f, -0.323737085f, -0.606530666f, -0.533752203f,
+    -3.85751626e-08f, 0.685351372f, 1.0f, 0.685351372f, -3.85751626e-08f, -0.533752203f,
+    -0.606530666f, -0.323737085f, 3.87144183e-09f, 0.152922541f, 0.135335281f,
+  },
+  {
+    0.120149054f, 0.0775801614f, -0.113974437f, -0.404718697f, -0.589270115f, -0.429971784f,
+    0.105268769f, 0.725076258f, 1.0f, 0.725076258f, 0.105268769f, -0.429971784f,
+    -0.589270115f, -0.404718697f, -0.113974437f, 0.0775801614f, 0.120149054f,
+  },
+  {
+    -0.036033731f, -0.158837512f, -0.318775117f, -0.427707165f, -0.367375553f, -0.0718159154f,
+    0.391842604f, 0.823567629f, 1.0f, 0.823567629f, 0.391842604f, -0.0718159154f,
+    -0.367375553f, -0.427707165f, -0.318775117f, -0.158837512f, -0.036033731f,
+  },
+  {
+    -0.100203089f, -0.109910108f, -0.0748214573f, 0.0311096199f, 0.218516812f, 0.46822381f,
+    0.7277987f, 0.925783634f, 1.0f, 0.925783634f, 0.7277987f, 0.46822381f,
+    0.218516812f, 0.0311096199f, -0.0748214573f, -0.109910108f, -0.100203089f,
+  },
+  {
+    0.135335281f, 0.216265172f, 0.324652463f, 0.45783335f, 0.606530666f, 0.754839599f,
+    0.882496893f, 0.969233215f, 1.0f, 0.969233215f, 0.882496893f, 0.754839599f,
+    0.606530666f, 0.45783335f, 0.324652463f, 0.216265172f, 0.135335281f,
+  },
+};
+
+static const float gabor_hsin[GABOR_NUM_PAIRS][GABOR_KSIZE] = {
+  {
+    -2.36627713e-08f, 0.152922586f, 0.324652463f, 0.323737025f, 5.30245963e-08f, -0.533752203f,
+    -0.882496893f, -0.685351372f, 0.0f, 0.685351372f, 0.882496893f, 0.533752203f,
+    -5.30245963e-08f, -0.323737025f, -0.324652463f, -0.152922586f, 2.36627713e-08f,
+  },
+  {
+    0.0622883812f, 0.201871112f, 0.303988576f, 0.21404238f, -0.143667042f, -0.620408773f,
+    -0.876195908f, -0.643177629f, 0.0f, 0.643177629f, 0.876195908f, 0.620408773f,
+    0.143667042f, -0.21404238f, -0.303988576f, -0.201871112f, -0.0622883812f,
+  },
+  {
+    0.130450025f, 0.146769449f, 0.0614950545f, -0.163333833f, -0.482612312f, -0.751415551f,
+    -0.790733933f, -0.511027813f, 0.0f, 0.511027813f, 0.790733933f, 0.751415551f,
+    0.482612312f, 0.163333833f, -0.0614950545f, -0.146769449f, -0.130450025f,
+  },
+  {
+    -0.0909669101f, -0.186253563f, -0.315912902f, -0.456775188f, -0.56580019f, -0.59207201f,
+    -0.49910903f, -0.286945432f, 0.0f, 0.286945432f, 0.49910903f, 0.59207201f,
+    0.56580019f, 0.456775188f, 0.315912902f, 0.186253563f, 0.0909669101f,
+  },
+  {
+    3.71693964e-08f, 5.19719592e-08f, 6.68735538e-08f, 7.85890251e-08f, 8.32908427e-08f, 7.77428397e-08f,
+    6.05937274e-08f, 3.32745955e-08f, -0.0f, -3.32745955e-08f, -6.05937274e-08f, -7.77428397e-08f,
+    -8.32908427e-08f, -7.85890251e-08f, -6.68735538e-08f, -5.19719592e-08f, -3.71693964e-08f,
+  },
+};
+
+static const float gabor_vcos[GABOR_NUM_PAIRS][GABOR_KSIZE] = {
+  {
+    0.135335281f, 0.216265172f, 0.324652463f, 0.45783335f, 0.606530666f, 0.754839599f,
+    0.882496893f, 0.969233215f, 1.0f, 0.969233215f, 0.882496893f, 0.754839599f,
+    0.606530666f, 0.45783335f, 0.324652463f, 0.216265172f, 0.135335281f,
+  },
+  {
+    -0.100203119f, -0.109910108f, -0.0748214945f, 0.0311095659f, 0.218516752f, 0.468223751f,
+    0.727798641f, 0.925783634f, 1.0f, 0.925783634f, 0.727798641f, 0.468223751f,
+    0.218516752f, 0.0311095659f, -0.0748214945f, -0.109910108f, -0.100203119f,
+  },
+  {
+    -0.036033731f, -0.158837512f, -0.318775117f, -0.427707165f, -0.367375553f, -0.0718159154f,
+    0.391842604f, 0.823567629f, 1.0f, 0.823567629f, 0.391842604f, -0.0718159154f,
+    -0.367375553f, -0.427707165f, -0.318775117f, -0.158837512f, -0.036033731f,
+  },
+  {
+    0.120149054f, 0.0775801614f, -0.113974437f, -0.404718697f, -0.589270115f, -0.429971784f,
+    0.105268769f, 0.725076258f, 1.0f, 0.725076258f, 0.105268769f, -0.429971784f,
+    -0.589270115f, -0.404718697f, -0.113974437f, 0.0775801614f, 0.120149054f,
+  },
+  {
+    0.135335281f, 0.152922541f, 3.87144183e-09f, -0.323737085f, -0.606530666f, -0.533752203f,
+    -3.85751626e-08f, 0.685351372f, 1.0f, 0.685351372f, -3.85751626e-08f, -0.533752203f,
+    -0.606530666f, -0.323737085f, 3.87144183e-09f, 0.152922541f, 0.135335281f,
+  },
+};
+
+static const float gabor_vsin[GABOR_NUM_PAIRS][GABOR_KSIZE] = {
+  {
+    -0.0f, -0.0f, -0.0f, -0.0f, -0.0f, -0.0f,
+    -0.0f, -0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  },
+  {
+    -0.0909668878f, -0.186253563f, -0.315912902f, -0.456775188f, -0.56580019f, -0.59207207f,
+    -0.499109089f, -0.286945462f, 0.0f, 0.286945462f, 0.499109089f, 0.59207207f,
+    0.56580019f, 0.456775188f, 0.315912902f, 0.186253563f, 0.0909668878f,
+  },
+  {
+    0.130450025f, 0.146769449f, 0.0614950545f, -0.163333833f, -0.482612312f, -0.751415551f,
+    -0.790733933f, -0.511027813f, 0.0f, 0.511027813f, 0.790733933f, 0.751415551f,
+    0.482612312f, 0.163333833f, -0.0614950545f, -0.146769449f, -0.130450025f,
+  },
+  {
+    0.0622883812f, 0.201871112f, 0.303988576f, 0.21404238f, -0.143667042f, -0.620408773f,
+    -0.876195908f, -0.643177629f, 0.0f, 0.643177629f, 0.876195908f, 0.620408773f,
+    0.143667042f, -0.21404238f, -0.303988576f, -0.201871112f, -0.0622883812f,
+  },
+  {
+    -2.36627713e-08f, 0.152922586f, 0.324652463f, 0.323737025f, 5.30245963e-08f, -0.533752203f,
+    -0.882496893f, -0.685351372f, 0.0f, 0.685351372f, 0.882496893f, 0.533752203f,
+    -5.30245963e-08f, -0.323737025f, -0.324652463f, -0.152922586f, 2.36627713e-08f,
+  },
+};
+
+/* Quality centre weight of every pixel */
+static const float quality_center_weight[FT_NN_INPUT_SIZE] = {
+  0.00559293991f, 0.00624132436f, 0.00692580966f, 0.00764225516f, 0.00838551018f, 0.0091494387f,
+  0.00992696825f, 0.0107101602f, 0.0114903245f, 0.0122581692f, 0.0130039752f, 0.0137177799f,
+  0.0143895932f, 0.015009637f, 0.0155685814f, 0.0160577651f, 0.0164694153f, 0.016796872f,
+  0.0170347448f, 0.0171790849f, 0.0172274671f, 0.0171790849f, 0.0170347448f, 0.016796872f,
+  0.0164694153f, 0.0160577651f, 0.0155685814f, 0.015009637f, 0.0143895932f, 0.0137177799f,
+  0.0130039752f, 0.0122581692f, 0.0114903245f, 0.0107101602f, 0.00992696825f, 0.0091494387f,
+  0.00838551018f, 0.00764225516f, 0.00692580966f, 0.00624132436f, 0.00690635899f, 0.00770700676f,
+  0.00855223369f, 0.00943692587f, 0.0103547238f, 0.0112980492f, 0.0122581692f, 0.0132252825f,
+  0.0141886566f, 0.0151368184f, 0.0160577651f, 0.0169391967f, 0.017768776f, 0.0185344312f,
+  0.0192246363f, 0.0198286939f, 0.0203370173f, 0.0207413677f, 0.0210351013f, 0.0212133396f,
+  0.021273084f, 0.0212133396f, 0.0210351013f, 0.0207413677f, 0.0203370173f, 0.0198286939f,
+  0.0192246363f, 0.0185344312f, 0.017768776f, 0.0169391967f, 0.0160577651f, 0.0151368184f,
+  0.0141886566f, 0.0132252825f, 0.0122581692f, 0.0112980492f, 0.0103547238f, 0.00943692587f,
+  0.00855223369f, 0.00770700676f, 0.00848038029f, 0.00946350303f, 0.0105013642f, 0.0115876803f,
+  0.0127146523f, 0.0138729764f, 0.0150519162f, 0.0162394363f, 0.0174223706f, 0.0185866319f,
+  0.0197174698f, 0.0207997821f, 0.0218184348f, 0.0227585901f, 0.0236060992f, 0.024347825f,
+  0.0249720011f, 0.0254685059f, 0.0258291848f, 0.0260480437f, 0.026121404f, 0.0260480437f,
+  0.0258291848f, 0.0254685059f, 0.0249720011f, 0.024347825f, 0.0236060992f, 0.0227585901f,
+  0.0218184348f, 0.0207997821f, 0.0197174698f, 0.0185866319f, 0.0174223706f, 0.0162394363f,
+  0.0150519162f, 0.0138729764f, 0.0127146523f, 0.0115876803f, 0.0105013642f, 0.00946350303f,
+  0.0103547238f, 0.0115551371f, 0.0128223877f, 0.0141488025f, 0.0155248586f, 0.0169391967f,
+  0.0183787029f, 0.0198286939f, 0.021273084f, 0.0226946697f, 0.0240754467f, 0.0253969803f,
+  0.0266407691f, 0.0277887192f, 0.0288235452f, 0.0297292098f, 0.030491339f, 0.0310975835f,
+  0.0315379873f, 0.0318052098f, 0.0318947844f, 0.0318052098f, 0.0315379873f, 0.0310975835f,
+  0.030491339f, 0.0297292098f, 0.0288235452f, 0.0277887192f, 0.0266407691f, 0.0253969803f,
+  0.0240754467f, 0.0226946697f, 0.021273084f, 0.0198286939f, 0.0183787029f, 0.0169391967f,
+  0.0155248586f, 0.0141488025f, 0.0128223877f, 0.0115551371f, 0.0125724133f, 0.0140299285f,
+  0.0155685814f, 0.0171790849f, 0.0188498553f, 0.0205670968f, 0.0223149098f, 0.0240754467f,
+  0.0258291848f, 0.0275552347f, 0.0292317439f, 0.0308363046f, 0.0323464796f, 0.0337402895f,
+  0.0349967442f, 0.0360963866f, 0.0370217338f, 0.0377578177f, 0.0382925458f, 0.038617f,
+  0.038725771f, 0.038617f, 0.0382925458f, 0.0377578177f, 0.0370217338f, 0.0360963866f,
+  0.0349967442f, 0.0337402895f, 0.0323464796f, 0.0308363046f, 0.0292317439f, 0.0275552347f,
+  0.0258291848f, 0.0240754467f, 0.0223149098f, 0.0205670968f, 0.0188498553f, 0.0171790849f,
+  0.0155685814f, 0.0140299285f, 0.0151794488f, 0.0169391967f, 0.0187969115f, 0.0207413677f,
+  0.0227585901f, 0.0248319265f, 0.0269421712f, 0.0290677771f, 0.0311851725f, 0.0332691409f,
+  0.0352932848f, 0.0372305699f, 0.0390538946f, 0.0407367274f, 0.0422537252f, 0.0435813889f,
+  0.0446986221f, 0.0455873385f, 0.0462329462f, 0.0466246828f, 0.0467560068f, 0.0466246828f,
+  0.0462329462f, 0.0455873385f, 0.0446986221f, 0.0435813889f, 0.0422537252f, 0.0407367274f,
+  0.0390538946f, 0.0372305699f, 0.0352932848f, 0.0332691409f, 0.0311851725f, 0.0290677771f,
+  0.0269421712f, 0.0248319265f, 0.0227585901f, 0.0207413677f, 0.0187969115f, 0.0169391967f,
+  0.0182242878f, 0.0203370173f, 0.022567369f, 0.0249018632f, 0.0273237191f, 0.0298129432f,
+  0.0323464796f, 0.0348984599f, 0.0374405831f, 0.03994257f, 0.0423727371f, 0.0446986221f,
+  0.0468876883f, 0.0489080772f, 0.0507293791f, 0.0523233451f, 0.0536646806f, 0.0547316819f,
+  0.055506777f, 0.0559771061f, 0.0561347567f, 0.0559771061f, 0.055506777f, 0.0547316819f,
+  0.0536646806f, 0.0523233451f, 0.0507293791f, 0.0489080772f, 0.0468876883f, 0.0446986221f,
+  0.0423727371f, 0.03994257f, 0.0374405831f, 0.0348984599f, 0.0323464796f, 0.0298129432f,
+  0.0273237191f, 0.0249018632f, 0.022567369f, 0.0203370173f, 0.0217571538f, 0.0242794473f,
+  0.0269421712f, 0.0297292098f, 0.0326205529f, 0.0355923288f, 0.038617f, 0.0416636951f,
+  0.0446986221f, 0.0476856306f, 0.0505868979f, 0.0533636659f, 0.0559771061f, 0.0583891571f,
+  0.0605635159f, 0.0624664798f, 0.0640678555f, 0.0653416812f, 0.0662670359f, 0.0668285415f,
+  0.0670167506f, 0.0668285415f, 0.0662670359f, 0.0653416812f, 0.0640678555f, 0.0624664798f,
+  0.0605635159f, 0.0583891571f, 0.0559771061f, 0.0533636659f, 0.0505868979f, 0.0476856306f,
+  0.0446986221f, 0.0416636951f, 0.038617f, 0.0355923288f, 0.0326205529f, 0.0297292098f,
+  0.0269421712f, 0.0242794473f, 0.0258291848f, 0.0288235452f, 0.0319846198f, 0.0352932848f,
+  0.038725771f, 0.0422537252f, 0.0458444916f, 0.0494613983f, 0.0530643351f, 0.0566103905f,
+  0.0600546673f, 0.063351132f, 0.0664536804f, 0.0693171695f, 0.0718984753f, 0.074157618f,
+  0.0760586858f, 0.0775709227f, 0.078669481f, 0.0793360546f, 0.0795595124f, 0.0793360546f,
+  0.078669481f, 0.0775709227f, 0.0760586858f, 0.074157618f, 0.0718984753f, 0.0693171695f,
+  0.0664536804f, 0.063351132f, 0.0600546673f, 0.0566103905f, 0.0530643351f, 0.0494613983f,
+  0.0458444916f, 0.0422537252f, 0.038725771f, 0.0352932848f, 0.0319846198f, 0.0288235452f,
+  0.030491339f, 0.034026172f, 0.0377578177f, 0.0416636951f, 0.0457157418f, 0.0498805046f,
+  0.0541194007f, 0.0583891571f, 0.0626424253f, 0.0668285415f, 0.0708944872f, 0.0747859627f,
+  0.0784485191f, 0.0818288699f, 0.0848761201f, 0.0875430107f, 0.089787215f, 0.0915724337f,
+  0.0928692594f, 0.093656145f, 0.0939199403f, 0.093656145f, 0.0928692594f, 0.0915724337f,
+  0.089787215f, 0.0875430107f, 0.0848761201f, 0.0818288699f, 0.0784485191f, 0.0747859627f,
+  0.0708944872f, 0.0668285415f, 0.0626424253f, 0.0583891571f, 0.0541194007f, 0.0498805046f,
+  0.0457157418f, 0.0416636951f, 0.0377578177f, 0.034026172f, 0.0357930996f, 0.03994257f,
+  0.0443230681f, 0.0489080772f, 0.0536646806f, 0.0585536025f, 0.063529551f, 0.0685417205f,
+  0.0735345334f, 0.0784485191f, 0.0832214504f, 0.0877895579f, 0.0920889825f, 0.0960570946f,
+  0.0996341705f, 0.10276477f, 0.105399221f, 0.107494824f, 0.109017141f, 0.109940879f,
+  0.11025051f, 0.109940879f, 0.109017141f, 0.107494824f, 0.105399221f, 0.10276477f,
+  0.0996341705f, 0.0960570946f, 0.0920889825f, 0.0877895579f, 0.0832214504f, 0.0784485191f,
+  0.0735345334f, 0.0685417205f, 0.063529551f, 0.0585536025f, 0.0536646806f, 0.0489080772f,
+  0.0443230681f, 0.03994257f, 0.0417810455f, 0.0466246828f, 0.0517380051f, 0.0570900701f,
+  0.0626424253f, 0.0683492273f, 0.074157618f, 0.0800082907f, 0.0858363658f, 0.0915724337f,
+  0.0971438363f, 0.102476165f, 0.107494824f, 0.112126775f, 0.116302274f, 0.119956627f,
+  0.12303178f, 0.125477955f, 0.127254978f, 0.128333211f, 0.128694683f, 0.128333211f,
+  0.127254978f, 0.125477955f, 0.12303178f, 0.119956627f, 0.116302274f, 0.112126775f,
+  0.107494824f, 0.102476165f, 0.0971438363f, 0.0915724337f, 0.0858363658f, 0.0800082907f,
+  0.074157618f, 0.0683492273f, 0.0626424253f, 0.0570900701f, 0.0517380051f, 0.0466246828f,
+  0.0484971553f, 0.0541194007f, 0.0600546673f, 0.0662670359f, 0.0727119073f, 0.0793360546f,
+  0.0860781148f, 0.0928692594f, 0.0996341705f, 0.106292285f, 0.112759262f, 0.118948735f,
+  0.124774121f, 0.130150676f, 0.134997353f, 0.139239103f, 0.142808586f, 0.145648003f,
+  0.147710651f, 0.148962215f, 0.149381757f, 0.148962215f, 0.147710651f, 0.145648003f,
+  0.142808586f, 0.139239103f, 0.134997353f, 0.130150676f, 0.124774121f, 0.118948735f,
+  0.112759262f, 0.106292285f, 0.0996341705f, 0.0928692594f, 0.0860781148f, 0.0793360546f,
+  0.0727119073f, 0.0662670359f, 0.0600546673f, 0.0541194007f, 0.0559771061f, 0.0624664798f,
+  0.0693171695f, 0.07648772f, 0.0839266106f, 0.0915724337f, 0.0993543565f, 0.107192934f,
+  0.115001231f, 0.122686252f, 0.130150676f, 0.137294769f, 0.144018635f, 0.150224403f,
+  0.155818626f, 0.160714611f, 0.164834619f, 0.168111965f, 0.170492753f, 0.171937346f,
+  0.172421604f, 0.171937346f, 0.170492753f, 0.168111965f, 0.164834619f, 0.160714611f,
+  0.155818626f, 0.150224403f, 0.144018635f, 0.137294769f, 0.130150676f, 0.122686252f,
+  0.115001231f, 0.107192934f, 0.0993543565f, 0.0915724337f, 0.0839266106f, 0.07648772f,
+  0.0693171695f, 0.0624664798f, 0.0642482936f, 0.0716965571f, 0.0795595124f, 0.0877895579f,
+  0.0963276252f, 0.105103195f, 0.114034973f, 0.12303178f, 0.13199383f, 0.140814394f,
+  0.149381757f, 0.157581493f, 0.165298879f, 0.172421604f, 0.17884244f, 0.184461847f,
+  0.189190641f, 0.192952245f, 0.195684806f, 0.197342888f, 0.197898701f, 0.197342888f,
+  0.195684806f, 0.192952245f, 0.189190641f, 0.184461847f, 0.17884244f, 0.172421604f,
+  0.165298879f, 0.157581493f, 0.149381757f, 0.140814394f, 0.13199383f, 0.12303178f,
+  0.114034973f, 0.105103195f, 0.0963276252f, 0.0877895579f, 0.0795595124f, 0.0716965571f,
+  0.0733280182f, 0.0818288699f, 0.0908030272f, 0.10019619f, 0.109940879f, 0.119956627f,
+  0.130150676f, 0.140418917f, 0.150647506f, 0.160714611f, 0.170492753f, 0.179851264f,
+  0.188659295f, 0.196788639f, 0.204116866f, 0.210530445f, 0.215927497f, 0.2202207f,
+  0.223339438f, 0.225231841f, 0.225866199f, 0.225231841f, 0.223339438f, 0.2202207f,
+  0.215927497f, 0.210530445f, 0.204116866f, 0.196788639f, 0.188659295f, 0.179851264f,
+  0.170492753f, 0.160714611f, 0.150647506f, 0.140418917f, 0.130150676f, 0.119956627f,
+  0.109940879f, 0.10019619f, 0.0908030272f, 0.0818288699f, 0.0832214504f, 0.0928692594f,
+  0.103054218f, 0.11371471f, 0.124774121f, 0.136141226f, 0.147710651f, 0.159364298f,
+  0.170972928f, 0.182398304f, 0.193495691f, 0.204116866f, 0.214113265f, 0.223339438f,
+  0.231656387f, 0.238935277f, 0.245060533f, 0.24993296f, 0.253472477f, 0.255620182f,
+  0.256340146f, 0.255620182f, 0.253472477f, 0.24993296f, 0.245060533f, 0.238935277f,
+  0.231656387f, 0.223339438f, 0.214113265f, 0.204116866f, 0.193495691f, 0.182398304f,
+  0.170972928f, 0.159364298f, 0.147710651f, 0.136141226f, 0.124774121f, 0.11371471f,
+  0.103054218f, 0.0928692594f, 0.0939199403f, 0.104808018f, 0.116302274f, 0.128333211f,
+  0.140814394f, 0.153642759f, 0.166699484f, 0.179851264f, 0.192952245f, 0.205846399f,
+  0.218370393f, 0.230356976f, 0.241638482f, 0.252050698f, 0.26143685f, 0.269651443f,
+  0.276564121f, 0.282062948f, 0.286057442f, 0.288481295f, 0.289293766f, 0.288481295f,
+  0.286057442f, 0.282062948f, 0.276564121f, 0.269651443f, 0.26143685f, 0.252050698f,
+  0.241638482f, 0.230356976f, 0.218370393f, 0.205846399f, 0.192952245f, 0.179851264f,
+  0.166699484f, 0.153642759f, 0.140814394f, 0.128333211f, 0.116302274f, 0.104808018f,
+  0.105399221f, 0.117618062f, 0.130517215f, 0.144018635f, 0.158025309f, 0.172421604f,
+  0.18707417f, 0.201833412f, 0.216535643f, 0.231005773f, 0.245060533f, 0.258512169f,
+  0.271172523f, 0.282857358f, 0.293390721f, 0.302609384f, 0.310366929f, 0.316537827f,
+  0.321020603f, 0.323740661f, 0.324652463f, 0.323740661f, 0.321020603f, 0.316537827f,
+  0.310366929f, 0.302609384f, 0.293390721f, 0.282857358f, 0.271172523f, 0.258512169f,
+  0.245060533f, 0.231005773f, 0.216535643f, 0.201833412f, 0.18707417f, 0.172421604f,
+  0.158025309f, 0.144018635f, 0.130517215f, 0.117618062f, 0.117618062f, 0.131253451f,
+  0.145648003f, 0.160714611f, 0.176345065f, 0.192410335f, 0.208761558f, 0.225231841f,
+  0.241638482f, 0.257786125f, 0.273470223f, 0.288481295f, 0.302609384f, 0.315648794f,
+  0.327403307f, 0.337690651f, 0.34634757f, 0.353233814f, 0.358236253f, 0.361271679f,
+  0.36228919f, 0.361271679f, 0.358236253f, 0.353233814f, 0.34634757f, 0.337690651f,
+  0.327403307f, 0.315648794f, 0.302609384f, 0.288481295f, 0.273470223f, 0.257786125f,
+  0.241638482f, 0.225231841f, 0.208761558f, 0.192410335f, 0.176345065f, 0.160714611f,
+  0.145648003f, 0.131253451f, 0.130517215f, 0.145648003f, 0.161621168f, 0.178340152f,
+  0.195684806f, 0.213511914f, 0.231656387f, 0.24993296f, 0.268138915f, 0.286057442f,
+  0.303461671f, 0.320118994f, 0.335796475f, 0.35026598f, 0.363309562f, 0.374725103f,
+  0.384331435f, 0.391972899f, 0.397523969f, 0.400892258f, 0.402021348f, 0.400892258f,
+  0.397523969f, 0.391972899f, 0.384331435f, 0.374725103f, 0.363309562f, 0.35026598f,
+  0.335796475f, 0.320118994f, 0.303461671f, 0.286057442f, 0.268138915f, 0.24993296f,
+  0.231656387f, 0.213511914f, 0.195684806f, 0.178340152f, 0.161621168f, 0.145648003f,
+  0.144018635f, 0.160714611f, 0.178340152f, 0.196788639f, 0.215927497f, 0.235598773f,
+  0.255620182f, 0.275787383f, 0.295876682f, 0.315648794f, 0.334853351f, 0.353233814f,
+  0.370533109f, 0.386499375f, 0.400892258f, 0.413488746f, 0.424088746f, 0.432520717f,
+  0.438646019f, 0.442362756f, 0.443608671f, 0.442362756f, 0.438646019f, 0.432520717f,
+  0.424088746f, 0.413488746f, 0.400892258f, 0.386499375f, 0.370533109f, 0.353233814f,
+  0.334853351f, 0.315648794f, 0.295876682f, 0.275787383f, 0.255620182f, 0.235598773f,
+  0.215927497f, 0.196788639f, 0.178340152f, 0.160714611f, 0.158025309f, 0.176345065f,
+  0.195684806f, 0.215927497f, 0.236927748f, 0.258512169f, 0.280480802f, 0.302609384f,
+  0.324652463f, 0.34634757f, 0.367419869f, 0.387587935f, 0.40656966f, 0.424088746f,
+  0.439881444f, 0.453702986f, 0.465333909f, 0.47458595f, 0.48130697f, 0.48538518f,
+  0.486752242f, 0.48538518f, 0.48130697f, 0.47458595f, 0.465333909f, 0.453702986f,
+  0.439881444f, 0.424088746f, 0.40656966f, 0.387587935f, 0.367419869f, 0.34634757f,
+  0.324652463f, 0.302609384f, 0.280480802f, 0.258512169f, 0.236927748f, 0.215927497f,
+  0.195684806f, 0.176345065f, 0.172421604f, 0.192410335f, 0.213511914f, 0.235598773f,
+  0.258512169f, 0.282062948f, 0.306032926f, 0.330177426f, 0.354228675f, 0.377900243f,
+  0.400892258f, 0.422897667f, 0.443608671f, 0.462723762f, 0.479955167f, 0.495035887f,
+  0.507726431f, 0.517821312f, 0.52515465f, 0.529604375f, 0.531095982f, 0.529604375f,
+  0.52515465f, 0.517821312f, 0.507726431f, 0.495035887f, 0.479955167f, 0.462723762f,
+  0.443608671f, 0.422897667f, 0.400892258f, 0.377900243f, 0.354228675f, 0.330177426f,
+  0.306032926f, 0.282062948f, 0.258512169f, 0.235598773f, 0.213511914f, 0.192410335f,
+  0.18707417f, 0.208761558f, 0.231656387f, 0.255620182f, 0.280480802f, 0.306032926f,
+  0.332039922f, 0.358236253f, 0.384331435f, 0.4100146f, 0.434960514f, 0.458835959f,
+  0.48130697f, 0.502046525f, 0.520742297f, 0.537104547f, 0.550873518f, 0.561826289f,
+  0.569782853f, 0.574610651f, 0.576229036f, 0.574610651f, 0.569782853f, 0.561826289f,
+  0.550873518f, 0.537104547f, 0.520742297f, 0.502046525f, 0.48130697f, 0.458835959f,
+  0.434960514f, 0.4100146f, 0.384331435f, 0.358236253f, 0.332039922f, 0.306032926f,
+  0.280480802f, 0.255620182f, 0.231656387f, 0.208761558f, 0.201833412f, 0.225231841f,
+  0.24993296f, 0.275787383f, 0.302609384f, 0.330177426f, 0.358236253f, 0.386499375f,
+  0.414653301f, 0.442362756f, 0.469276786f, 0.495035887f, 0.519279718f, 0.54165554f,
+  0.561826289f, 0.579479456f, 0.594334781f, 0.6061517f, 0.614735901f, 0.619944692f,
+  0.62169075f, 0.619944692f, 0.614735901f, 0.6061517f, 0.594334781f, 0.579479456f,
+  0.561826289f, 0.54165554f, 0.519279718f, 0.495035887f, 0.469276786f, 0.442362756f,
+  0.414653301f, 0.386499375f, 0.358236253f, 0.330177426f, 0.302609384f, 0.275787383f,
+  0.24993296f, 0.225231841f, 0.216535643f, 0.241638482f, 0.268138915f, 0.295876682f,
+  0.324652463f, 0.354228675f, 0.384331435f, 0.414653301f, 0.444858074f, 0.47458595f,
+  0.503460467f, 0.531095982f, 0.557105839f, 0.58111155f, 0.602751672f, 0.62169075f,
+  0.637628138f, 0.650305808f, 0.659515381f, 0.665103555f, 0.66697681f, 0.665103555f,
+  0.659515381f, 0.650305808f, 0.637628138f, 0.62169075f, 0.602751672f, 0.58111155f,
+  0.557105839f, 0.531095982f, 0.503460467f, 0.47458595f, 0.444858074f, 0.414653301f,
+  0.384331435f, 0.354228675f, 0.324652463f, 0.295876682f, 0.268138915f, 0.241638482f,
+  0.231005773f, 0.257786125f, 0.286057442f, 0.315648794f, 0.34634757f, 0.377900243f,
+  0.4100146f, 0.442362756f, 0.47458595f, 0.506300449f, 0.537104547f, 0.566586792f,
+  0.594334781f, 0.619944692f, 0.643030882f, 0.663235605f, 0.680238008f, 0.693762898f,
+  0.70358789f, 0.709549487f, 0.711547911f, 0.709549487f, 0.70358789f, 0.693762898f,
+  0.680238008f, 0.663235605f, 0.643030882f, 0.619944692f, 0.594334781f, 0.566586792f,
+  0.537104547f, 0.506300449f, 0.47458595f, 0.442362756f, 0.4100146f, 0.377900243f,
+  0.34634757f, 0.315648794f, 0.286057442f, 0.257786125f, 0.245060533f, 0.273470223f,
+  0.303461671f, 0.334853351f, 0.367419869f, 0.400892258f, 0.434960514f, 0.469276786f,
+  0.503460467f, 0.537104547f, 0.569782853f, 0.601058781f, 0.630495012f, 0.657663047f,
+  0.682153881f, 0.70358789f, 0.721624732f, 0.735972524f, 0.74639523f, 0.752719581f,
+  0.754839599f, 0.752719581f, 0.74639523f, 0.735972524f, 0.721624732f, 0.70358789f,
+  0.682153881f, 0.657663047f, 0.630495012f, 0.601058781f, 0.569782853f, 0.537104547f,
+  0.503460467f, 0.469276786f, 0.434960514f, 0.400892258f, 0.367419869f, 0.334853351f,
+  0.303461671f, 0.273470223f, 0.258512169f, 0.288481295f, 0.320118994f, 0.353233814f,
+  0.387587935f, 0.422897667f, 0.458835959f, 0.495035887f, 0.531095982f, 0.566586792f,
+  0.601058781f, 0.634051561f, 0.665103555f, 0.693762898f, 0.719597995f, 0.74220854f,
+  0.761235476f, 0.776370823f, 0.787365675f, 0.794037163f, 0.79627353f, 0.794037163f,
+  0.787365675f, 0.776370823f, 0.761235476f, 0.74220854f, 0.719597995f, 0.693762898f,
+  0.665103555f, 0.634051561f, 0.601058781f, 0.566586792f, 0.531095982f, 0.495035887f,
+  0.458835959f, 0.422897667f, 0.387587935f, 0.353233814f, 0.320118994f, 0.288481295f,
+  0.271172523f, 0.302609384f, 0.335796475f, 0.370533109f, 0.40656966f, 0.443608671f,
+  0.48130697f, 0.519279718f, 0.557105839f, 0.594334781f, 0.630495012f, 0.665103555f,
+  0.697676301f, 0.727739215f, 0.754839599f, 0.77855742f, 0.798516214f, 0.814392745f,
+  0.825926065f, 0.832924306f, 0.835270226f, 0.832924306f, 0.825926065f, 0.814392745f,
+  0.798516214f, 0.77855742f, 0.754839599f, 0.727739215f, 0.697676301f, 0.665103555f,
+  0.630495012f, 0.594334781f, 0.557105839f, 0.519279718f, 0.48130697f, 0.443608671f,
+  0.40656966f, 0.370533109f, 0.335796475f, 0.302609384f, 0.282857358f, 0.315648794f,
+  0.35026598f, 0.386499375f, 0.424088746f, 0.462723762f, 0.502046525f, 0.54165554f,
+  0.58111155f, 0.619944692f, 0.657663047f, 0.693762898f, 0.727739215f, 0.759097517f,
+  0.787365675f, 0.812105536f, 0.832924306f, 0.84948498f, 0.861515284f, 0.868815064f,
+  0.871262014f, 0.868815064f, 0.861515284f, 0.84948498f, 0.832924306f, 0.812105536f,
+  0.787365675f, 0.759097517f, 0.727739215f, 0.693762898f, 0.657663047f, 0.619944692f,
+  0.58111155f, 0.54165554f, 0.502046525f, 0.462723762f, 0.424088746f, 0.386499375f,
+  0.35026598f, 0.315648794f, 0.293390721f, 0.327403307f, 0.363309562f, 0.400892258f,
+  0.439881444f, 0.479955167f, 0.520742297f, 0.561826289f, 0.602751672f, 0.643030882f,
+  0.682153881f, 0.719597995f, 0.754839599f, 0.787365675f, 0.816686511f, 0.842347622f,
+  0.863941669f, 0.881119072f, 0.893597364f, 0.901168942f, 0.903707087f, 0.901168942f,
+  0.893597364f, 0.881119072f, 0.863941669f, 0.842347622f, 0.816686511f, 0.787365675f,
+  0.754839599f, 0.719597995f, 0.682153881f, 0.643030882f, 0.602751672f, 0.561826289f,
+  0.520742297f, 0.479955167f, 0.439881444f, 0.400892258f, 0.363309562f, 0.327403307f,
+  0.302609384f, 0.337690651f, 0.374725103f, 0.413488746f, 0.453702986f, 0.495035887f,
+  0.537104547f, 0.579479456f, 0.62169075f, 0.663235605f, 0.70358789f, 0.74220854f,
+  0.77855742f, 0.812105536f, 0.842347622f, 0.868815064f, 0.891087651f, 0.908804774f,
+  0.921675086f, 0.929484606f, 0.932102501f, 0.929484606f, 0.921675086f, 0.908804774f,
+  0.891087651f, 0.868815064f, 0.842347622f, 0.812105536f, 0.77855742f, 0.74220854f,
+  0.70358789f, 0.663235605f, 0.62169075f, 0.579479456f, 0.537104547f, 0.495035887f,
+  0.453702986f, 0.413488746f, 0.374725103f, 0.337690651f, 0.310366929f, 0.34634757f,
+  0.384331435f, 0.424088746f, 0.465333909f, 0.507726431f, 0.550873518f, 0.594334781f,
+  0.637628138f, 0.680238008f, 0.721624732f, 0.761235476f, 0.798516214f, 0.832924306f,
+  0.863941669f, 0.891087651f, 0.913931191f, 0.932102501f, 0.945302784f, 0.953312516f,
+  0.955997467f, 0.953312516f, 0.945302784f, 0.932102501f, 0.913931191f, 0.891087651f,
+  0.863941669f, 0.832924306f, 0.798516214f, 0.761235476f, 0.721624732f, 0.680238008f,
+  0.637628138f, 0.594334781f, 0.550873518f, 0.507726431f, 0.465333909f, 0.424088746f,
+  0.384331435f, 0.34634757f, 0.316537827f, 0.353233814f, 0.391972899f, 0.432520717f,
+  0.47458595f, 0.517821312f, 0.561826289f, 0.6061517f, 0.650305808f, 0.693762898f,
+  0.735972524f, 0.776370823f, 0.814392745f, 0.84948498f, 0.881119072f, 0.908804774f,
+  0.932102501f, 0.950635076f, 0.964097857f, 0.972266853f, 0.97500515f, 0.972266853f,
+  0.964097857f, 0.950635076f, 0.932102501f, 0.908804774f, 0.881119072f, 0.84948498f,
+  0.814392745f, 0.776370823f, 0.735972524f, 0.693762898f, 0.650305808f, 0.6061517f,
+  0.561826289f, 0.517821312f, 0.47458595f, 0.432520717f, 0.391972899f, 0.353233814f,
+  0.321020603f, 0.358236253f, 0.397523969f, 0.438646019f, 0.48130697f, 0.52515465f,
+  0.569782853f, 0.614735901f, 0.659515381f, 0.70358789f, 0.74639523f, 0.787365675f,
+  0.825926065f, 0.861515284f, 0.893597364f, 0.921675086f, 0.945302784f, 0.964097857f,
+  0.977751255f, 0.986035943f, 0.988813043f, 0.986035943f, 0.977751255f, 0.964097857f,
+  0.945302784f, 0.921675086f, 0.893597364f, 0.861515284f, 0.825926065f, 0.787365675f,
+  0.74639523f, 0.70358789f, 0.659515381f, 0.614735901f, 0.569782853f, 0.52515465f,
+  0.48130697f, 0.438646019f, 0.397523969f, 0.358236253f, 0.323740661f, 0.361271679f,
+  0.400892258f, 0.442362756f, 0.48538518f, 0.529604375f, 0.574610651f, 0.619944692f,
+  0.665103555f, 0.709549487f, 0.752719581f, 0.794037163f, 0.832924306f, 0.868815064f,
+  0.901168942f, 0.929484606f, 0.953312516f, 0.972266853f, 0.986035943f, 0.994390786f,
+  0.997191429f, 0.994390786f, 0.986035943f, 0.972266853f, 0.953312516f, 0.929484606f,
+  0.901168942f, 0.868815064f, 0.832924306f, 0.794037163f, 0.752719581f, 0.709549487f,
+  0.665103555f, 0.619944692f, 0.574610651f, 0.529604375f, 0.48538518f, 0.442362756f,
+  0.400892258f, 0.361271679f, 0.324652463f, 0.36228919f, 0.402021348f, 0.443608671f,
+  0.486752242f, 0.531095982f, 0.576229036f, 0.62169075f, 0.66697681f, 0.711547911f,
+  0.754839599f, 0.79627353f, 0.835270226f, 0.871262014f, 0.903707087f, 0.932102501f,
+  0.955997467f, 0.97500515f, 0.988813043f, 0.997191429f, 1.0f, 0.997191429f,
+  0.988813043f, 0.97500515f, 0.955997467f, 0.932102501f, 0.903707087f, 0.871262014f,
+  0.835270226f, 0.79627353f, 0.754839599f, 0.711547911f, 0.66697681f, 0.62169075f,
+  0.576229036f, 0.531095982f, 0.486752242f, 0.443608671f, 0.402021348f, 0.36228919f,
+  0.323740661f, 0.361271679f, 0.400892258f, 0.442362756f, 0.48538518f, 0.529604375f,
+  0.574610651f, 0.619944692f, 0.665103555f, 0.709549487f, 0.752719581f, 0.794037163f,
+  0.832924306f, 0.868815064f, 0.901168942f, 0.929484606f, 0.953312516f, 0.972266853f,
+  0.986035943f, 0.994390786f, 0.997191429f, 0.994390786f, 0.986035943f, 0.972266853f,
+  0.953312516f, 0.929484606f, 0.901168942f, 0.868815064f, 0.832924306f, 0.794037163f,
+  0.752719581f, 0.709549487f, 0.665103555f, 0.619944692f, 0.574610651f, 0.529604375f,
+  0.48538518f, 0.442362756f, 0.400892258f, 0.361271679f, 0.321020603f, 0.358236253f,
+  0.397523969f, 0.438646019f, 0.48130697f, 0.52515465f, 0.569782853f, 0.614735901f,
+  0.659515381f, 0.70358789f, 0.74639523f, 0.787365675f, 0.825926065f, 0.861515284f,
+  0.893597364f, 0.921675086f, 0.945302784f, 0.964097857f, 0.977751255f, 0.986035943f,
+  0.988813043f, 0.986035943f, 0.977751255f, 0.964097857f, 0.945302784f, 0.921675086f,
+  0.893597364f, 0.861515284f, 0.825926065f, 0.787365675f, 0.74639523f, 0.70358789f,
+  0.659515381f, 0.614735901f, 0.569782853f, 0.52515465f, 0.48130697f, 0.438646019f,
+  0.397523969f, 0.358236253f, 0.316537827f, 0.353233814f, 0.391972899f, 0.432520717f,
+  0.47458595f, 0.517821312f, 0.561826289f, 0.6061517f, 0.650305808f, 0.693762898f,
+  0.735972524f, 0.776370823f, 0.814392745f, 0.84948498f, 0.881119072f, 0.908804774f,
+  0.932102501f, 0.950635076f, 0.964097857f, 0.972266853f, 0.97500515f, 0.972266853f,
+  0.964097857f, 0.950635076f, 0.932102501f, 0.908804774f, 0.881119072f, 0.84948498f,
+  0.814392745f, 0.776370823f, 0.735972524f, 0.693762898f, 0.650305808f, 0.6061517f,
+  0.561826289f, 0.517821312f, 0.47458595f, 0.432520717f, 0.391972899f, 0.353233814f,
+  0.310366929f, 0.34634757f, 0.384331435f, 0.424088746f, 0.465333909f, 0.507726431f,
+  0.550873518f, 0.594334781f, 0.637628138f, 0.680238008f, 0.721624732f, 0.761235476f,
+  0.798516214f, 0.832924306f, 0.863941669f, 0.891087651f, 0.913931191f, 0.932102501f,
+  0.945302784f, 0.953312516f, 0.955997467f, 0.953312516f, 0.945302784f, 0.932102501f,
+  0.913931191f, 0.891087651f, 0.863941669f, 0.832924306f, 0.798516214f, 0.761235476f,
+  0.721624732f, 0.680238008f, 0.637628138f, 0.594334781f, 0.550873518f, 0.507726431f,
+  0.465333909f, 0.424088746f, 0.384331435f, 0.34634757f, 0.302609384f, 0.337690651f,
+  0.374725103f, 0.413488746f, 0.453702986f, 0.495035887f, 0.537104547f, 0.579479456f,
+  0.62169075f, 0.663235605f, 0.70358789f, 0.74220854f, 0.77855742f, 0.812105536f,
+  0.842347622f, 0.868815064f, 0.891087651f, 0.908804774f, 0.921675086f, 0.929484606f,
+  0.932102501f, 0.929484606f, 0.921675086f, 0.908804774f, 0.891087651f, 0.868815064f,
+  0.842347622f, 0.812105536f, 0.77855742f, 0.74220854f, 0.70358789f, 0.663235605f,
+  0.62169075f, 0.579479456f, 0.537104547f, 0.495035887f, 0.453702986f, 0.413488746f,
+  0.374725103f, 0.337690651f, 0.293390721f, 0.327403307f, 0.363309562f, 0.400892258f,
+  0.439881444f, 0.479955167f, 0.520742297f, 0.561826289f, 0.602751672f, 0.643030882f,
+  0.682153881f, 0.719597995f, 0.754839599f, 0.787365675f, 0.816686511f, 0.842347622f,
+  0.863941669f, 0.881119072f, 0.893597364f, 0.901168942f, 0.903707087f, 0.901168942f,
+  0.893597364f, 0.881119072f, 0.863941669f, 0.842347622f, 0.816686511f, 0.787365675f,
+  0.754839599f, 0.719597995f, 0.682153881f, 0.643030882f, 0.602751672f, 0.561826289f,
+  0.520742297f, 0.479955167f, 0.439881444f, 0.400892258f, 0.363309562f, 0.327403307f,
+  0.282857358f, 0.315648794f, 0.35026598f, 0.386499375f, 0.424088746f, 0.462723762f,
+  0.502046525f, 0.54165554f, 0.58111155f, 0.619944692f, 0.657663047f, 0.693762898f,
+  0.727739215f, 0.759097517f, 0.787365675f, 0.812105536f, 0.832924306f, 0.84948498f,
+  0.861515284f, 0.868815064f, 0.871262014f, 0.868815064f, 0.861515284f, 0.84948498f,
+  0.832924306f, 0.812105536f, 0.787365675f, 0.759097517f, 0.727739215f, 0.693762898f,
+  0.657663047f, 0.619944692f, 0.58111155f, 0.54165554f, 0.502046525f, 0.462723762f,
+  0.424088746f, 0.386499375f, 0.35026598f, 0.315648794f, 0.271172523f, 0.302609384f,
+  0.335796475f, 0.370533109f, 0.40656966f, 0.443608671f, 0.48130697f, 0.519279718f,
+  0.557105839f, 0.594334781f, 0.630495012f, 0.665103555f, 0.697676301f, 0.727739215f,
+  0.754839599f, 0.77855742f, 0.798516214f, 0.814392745f, 0.825926065f, 0.832924306f,
+  0.835270226f, 0.832924306f, 0.825926065f, 0.814392745f, 0.798516214f, 0.77855742f,
+  0.754839599f, 0.727739215f, 0.697676301f, 0.665103555f, 0.630495012f, 0.594334781f,
+  0.557105839f, 0.519279718f, 0.48130697f, 0.443608671f, 0.40656966f, 0.370533109f,
+  0.335796475f, 0.302609384f, 0.258512169f, 0.288481295f, 0.320118994f, 0.353233814f,
+  0.387587935f, 0.422897667f, 0.458835959f, 0.495035887f, 0.531095982f, 0.566586792f,
+  0.601058781f, 0.634051561f, 0.665103555f, 0.693762898f, 0.719597995f, 0.74220854f,
+  0.761235476f, 0.776370823f, 0.787365675f, 0.794037163f, 0.79627353f, 0.794037163f,
+  0.787365675f, 0.776370823f, 0.761235476f, 0.74220854f, 0.719597995f, 0.693762898f,
+  0.665103555f, 0.634051561f, 0.601058781f, 0.566586792f, 0.531095982f, 0.495035887f,
+  0.458835959f, 0.422897667f, 0.387587935f, 0.353233814f, 0.320118994f, 0.288481295f,
+  0.245060533f, 0.273470223f, 0.303461671f, 0.334853351f, 0.367419869f, 0.400892258f,
+  0.434960514f, 0.469276786f, 0.503460467f, 0.537104547f, 0.569782853f, 0.601058781f,
+  0.630495012f, 0.657663047f, 0.682153881f, 0.70358789f, 0.721624732f, 0.735972524f,
+  0.74639523f, 0.752719581f, 0.754839599f, 0.752719581f, 0.74639523f, 0.735972524f,
+  0.721624732f, 0.70358789f, 0.682153881f, 0.657663047f, 0.630495012f, 0.601058781f,
+  0.569782853f, 0.537104547f, 0.503460467f, 0.469276786f, 0.434960514f, 0.400892258f,
+  0.367419869f, 0.334853351f, 0.303461671f, 0.273470223f, 0.231005773f, 0.257786125f,
+  0.286057442f, 0.315648794f, 0.34634757f, 0.377900243f, 0.4100146f, 0.442362756f,
+  0.47458595f, 0.506300449f, 0.537104547f, 0.566586792f, 0.594334781f, 0.619944692f,
+  0.643030882f, 0.663235605f, 0.680238008f, 0.693762898f, 0.70358789f, 0.709549487f,
+  0.711547911f, 0.709549487f, 0.70358789f, 0.693762898f, 0.680238008f, 0.663235605f,
+  0.643030882f, 0.619944692f, 0.594334781f, 0.566586792f, 0.537104547f, 0.506300449f,
+  0.47458595f, 0.442362756f, 0.4100146f, 0.377900243f, 0.34634757f, 0.315648794f,
+  0.286057442f, 0.257786125f, 0.216535643f, 0.241638482f, 0.268138915f, 0.295876682f,
+  0.324652463f, 0.354228675f, 0.384331435f, 0.414653301f, 0.444858074f, 0.47458595f,
+  0.503460467f, 0.531095982f, 0.557105839f, 0.58111155f, 0.602751672f, 0.62169075f,
+  0.637628138f, 0.650305808f, 0.659515381f, 0.665103555f, 0.66697681f, 0.665103555f,
+  0.659515381f, 0.650305808f, 0.637628138f, 0.62169075f, 0.602751672f, 0.58111155f,
+  0.557105839f, 0.531095982f, 0.503460467f, 0.47458595f, 0.444858074f, 0.414653301f,
+  0.384331435f, 0.354228675f, 0.324652463f, 0.295876682f, 0.268138915f, 0.241638482f,
+  0.201833412f, 0.225231841f, 0.24993296f, 0.275787383f, 0.302609384f, 0.330177426f,
+  0.358236253f, 0.386499375f, 0.414653301f, 0.442362756f, 0.469276786f, 0.495035887f,
+  0.519279718f, 0.54165554f, 0.561826289f, 0.579479456f, 0.594334781f, 0.6061517f,
+  0.614735901f, 0.619944692f, 0.62169075f, 0.619944692f, 0.614735901f, 0.6061517f,
+  0.594334781f, 0.579479456f, 0.561826289f, 0.54165554f, 0.519279718f, 0.495035887f,
+  0.469276786f, 0.442362756f, 0.414653301f, 0.386499375f, 0.358236253f, 0.330177426f,
+  0.302609384f, 0.275787383f, 0.24993296f, 0.225231841f, 0.18707417f, 0.208761558f,
+  0.231656387f, 0.255620182f, 0.280480802f, 0.306032926f, 0.332039922f, 0.358236253f,
+  0.384331435f, 0.4100146f, 0.434960514f, 0.458835959f, 0.48130697f, 0.502046525f,
+  0.520742297f, 0.537104547f, 0.550873518f, 0.561826289f, 0.569782853f, 0.574610651f,
+  0.576229036f, 0.574610651f, 0.569782853f, 0.561826289f, 0.550873518f, 0.537104547f,
+  0.520742297f, 0.502046525f, 0.48130697f, 0.458835959f, 0.434960514f, 0.4100146f,
+  0.384331435f, 0.358236253f, 0.332039922f, 0.306032926f, 0.280480802f, 0.255620182f,
+  0.231656387f, 0.208761558f, 0.172421604f, 0.192410335f, 0.213511914f, 0.235598773f,
+  0.258512169f, 0.282062948f, 0.306032926f, 0.330177426f, 0.354228675f, 0.377900243f,
+  0.400892258f, 0.422897667f, 0.443608671f, 0.462723762f, 0.479955167f, 0.495035887f,
+  0.507726431f, 0.517821312f, 0.52515465f, 0.529604375f, 0.531095982f, 0.529604375f,
+  0.52515465f, 0.517821312f, 0.507726431f, 0.495035887f, 0.479955167f, 0.462723762f,
+  0.443608671f, 0.422897667f, 0.400892258f, 0.377900243f, 0.354228675f, 0.330177426f,
+  0.306032926f, 0.282062948f, 0.258512169f, 0.235598773f, 0.213511914f, 0.192410335f,
+  0.158025309f, 0.176345065f, 0.195684806f, 0.215927497f, 0.236927748f, 0.258512169f,
+  0.280480802f, 0.302609384f, 0.324652463f, 0.34634757f, 0.367419869f, 0.387587935f,
+  0.40656966f, 0.424088746f, 0.439881444f, 0.453702986f, 0.465333909f, 0.47458595f,
+  0.48130697f, 0.48538518f, 0.486752242f, 0.48538518f, 0.48130697f, 0.47458595f,
+  0.465333909f, 0.453702986f, 0.439881444f, 0.424088746f, 0.40656966f, 0.387587935f,
+  0.367419869f, 0.34634757f, 0.324652463f, 0.302609384f, 0.280480802f, 0.258512169f,
+  0.236927748f, 0.215927497f, 0.195684806f, 0.176345065f, 0.144018635f, 0.160714611f,
+  0.178340152f, 0.196788639f, 0.215927497f, 0.235598773f, 0.255620182f, 0.275787383f,
+  0.295876682f, 0.315648794f, 0.334853351f, 0.353233814f, 0.370533109f, 0.386499375f,
+  0.400892258f, 0.413488746f, 0.424088746f, 0.432520717f, 0.438646019f, 0.442362756f,
+  0.443608671f, 0.442362756f, 0.438646019f, 0.432520717f, 0.424088746f, 0.413488746f,
+  0.400892258f, 0.386499375f, 0.370533109f, 0.353233814f, 0.334853351f, 0.315648794f,
+  0.295876682f, 0.275787383f, 0.255620182f, 0.235598773f, 0.215927497f, 0.196788639f,
+  0.178340152f, 0.160714611f, 0.130517215f, 0.145648003f, 0.161621168f, 0.178340152f,
+  0.195684806f, 0.213511914f, 0.231656387f, 0.24993296f, 0.268138915f, 0.286057442f,
+  0.303461671f, 0.320118994f, 0.335796475f, 0.35026598f, 0.363309562f, 0.374725103f,
+  0.384331435f, 0.391972899f, 0.397523969f, 0.400892258f, 0.402021348f, 0.400892258f,
+  0.397523969f, 0.391972899f, 0.384331435f, 0.374725103f, 0.363309562f, 0.35026598f,
+  0.335796475f, 0.320118994f, 0.303461671f, 0.286057442f, 0.268138915f, 0.24993296f,
+  0.231656387f, 0.213511914f, 0.195684806f, 0.178340152f, 0.161621168f, 0.145648003f,
+  0.117618062f, 0.131253451f, 0.145648003f, 0.160714611f, 0.176345065f, 0.192410335f,
+  0.208761558f, 0.225231841f, 0.241638482f, 0.257786125f, 0.273470223f, 0.288481295f,
+  0.302609384f, 0.315648794f, 0.327403307f, 0.337690651f, 0.34634757f, 0.353233814f,
+  0.358236253f, 0.361271679f, 0.36228919f, 0.361271679f, 0.358236253f, 0.353233814f,
+  0.34634757f, 0.337690651f, 0.327403307f, 0.315648794f, 0.302609384f, 0.288481295f,
+  0.273470223f, 0.257786125f, 0.241638482f, 0.225231841f, 0.208761558f, 0.192410335f,
+  0.176345065f, 0.160714611f, 0.145648003f, 0.131253451f, 0.105399221f, 0.117618062f,
+  0.130517215f, 0.144018635f, 0.158025309f, 0.172421604f, 0.18707417f, 0.201833412f,
+  0.216535643f, 0.231005773f, 0.245060533f, 0.258512169f, 0.271172523f, 0.282857358f,
+  0.293390721f, 0.302609384f, 0.310366929f, 0.316537827f, 0.321020603f, 0.323740661f,
+  0.324652463f, 0.323740661f, 0.321020603f, 0.316537827f, 0.310366929f, 0.302609384f,
+  0.293390721f, 0.282857358f, 0.271172523f, 0.258512169f, 0.245060533f, 0.231005773f,
+  0.216535643f, 0.201833412f, 0.18707417f, 0.172421604f, 0.158025309f, 0.144018635f,
+  0.130517215f, 0.117618062f, 0.0939199403f, 0.104808018f, 0.116302274f, 0.128333211f,
+  0.140814394f, 0.153642759f, 0.166699484f, 0.179851264f, 0.192952245f, 0.205846399f,
+  0.218370393f, 0.230356976f, 0.241638482f, 0.252050698f, 0.26143685f, 0.269651443f,
+  0.276564121f, 0.282062948f, 0.286057442f, 0.288481295f, 0.289293766f, 0.288481295f,
+  0.286057442f, 0.282062948f, 0.276564121f, 0.269651443f, 0.26143685f, 0.252050698f,
+  0.241638482f, 0.230356976f, 0.218370393f, 0.205846399f, 0.192952245f, 0.179851264f,
+  0.166699484f, 0.153642759f, 0.140814394f, 0.128333211f, 0.116302274f, 0.104808018f,
+  0.0832214504f, 0.0928692594f, 0.103054218f, 0.11371471f, 0.124774121f, 0.136141226f,
+  0.147710651f, 0.159364298f, 0.170972928f, 0.182398304f, 0.193495691f, 0.204116866f,
+  0.214113265f, 0.223339438f, 0.231656387f, 0.238935277f, 0.245060533f, 0.24993296f,
+  0.253472477f, 0.255620182f, 0.256340146f, 0.255620182f, 0.253472477f, 0.24993296f,
+  0.245060533f, 0.238935277f, 0.231656387f, 0.223339438f, 0.214113265f, 0.204116866f,
+  0.193495691f, 0.182398304f, 0.170972928f, 0.159364298f, 0.147710651f, 0.136141226f,
+  0.124774121f, 0.11371471f, 0.103054218f, 0.0928692594f, 0.0733280182f, 0.0818288699f,
+  0.0908030272f, 0.10019619f, 0.109940879f, 0.119956627f, 0.130150676f, 0.140418917f,
+  0.150647506f, 0.160714611f, 0.170492753f, 0.179851264f, 0.188659295f, 0.196788639f,
+  0.204116866f, 0.210530445f, 0.215927497f, 0.2202207f, 0.223339438f, 0.225231841f,
+  0.225866199f, 0.225231841f, 0.223339438f, 0.2202207f, 0.215927497f, 0.210530445f,
+  0.204116866f, 0.196788639f, 0.188659295f, 0.179851264f, 0.170492753f, 0.160714611f,
+  0.150647506f, 0.140418917f, 0.130150676f, 0.119956627f, 0.109940879f, 0.10019619f,
+  0.0908030272f, 0.0818288699f, 0.0642482936f, 0.0716965571f, 0.0795595124f, 0.0877895579f,
+  0.0963276252f, 0.105103195f, 0.114034973f, 0.12303178f, 0.13199383f, 0.140814394f,
+  0.149381757f, 0.157581493f, 0.165298879f, 0.172421604f, 0.17884244f, 0.184461847f,
+  0.189190641f, 0.192952245f, 0.195684806f, 0.197342888f, 0.197898701f, 0.197342888f,
+  0.195684806f, 0.192952245f, 0.189190641f, 0.184461847f, 0.17884244f, 0.172421604f,
+  0.165298879f, 0.157581493f, 0.149381757f, 0.140814394f, 0.13199383f, 0.12303178f,
+  0.114034973f, 0.105103195f, 0.0963276252f, 0.0877895579f, 0.0795595124f, 0.0716965571f,
+  0.0559771061f, 0.0624664798f, 0.0693171695f, 0.07648772f, 0.0839266106f, 0.0915724337f,
+  0.0993543565f, 0.107192934f, 0.115001231f, 0.122686252f, 0.130150676f, 0.137294769f,
+  0.144018635f, 0.150224403f, 0.155818626f, 0.160714611f, 0.164834619f, 0.168111965f,
+  0.170492753f, 0.171937346f, 0.172421604f, 0.171937346f, 0.170492753f, 0.168111965f,
+  0.164834619f, 0.160714611f, 0.155818626f, 0.150224403f, 0.144018635f, 0.137294769f,
+  0.130150676f, 0.122686252f, 0.115001231f, 0.107192934f, 0.0993543565f, 0.0915724337f,
+  0.0839266106f, 0.07648772f, 0.0693171695f, 0.0624664798f, 0.0484971553f, 0.0541194007f,
+  0.0600546673f, 0.0662670359f, 0.0727119073f, 0.0793360546f, 0.0860781148f, 0.0928692594f,
+  0.0996341705f, 0.106292285f, 0.112759262f, 0.118948735f, 0.124774121f, 0.130150676f,
+  0.134997353f, 0.139239103f, 0.142808586f, 0.145648003f, 0.147710651f, 0.148962215f,
+  0.149381757f, 0.148962215f, 0.147710651f, 0.145648003f, 0.142808586f, 0.139239103f,
+  0.134997353f, 0.130150676f, 0.124774121f, 0.118948735f, 0.112759262f, 0.106292285f,
+  0.0996341705f, 0.0928692594f, 0.0860781148f, 0.0793360546f, 0.0727119073f, 0.0662670359f,
+  0.0600546673f, 0.0541194007f, 0.0417810455f, 0.0466246828f, 0.0517380051f, 0.0570900701f,
+  0.0626424253f, 0.0683492273f, 0.074157618f, 0.0800082907f, 0.0858363658f, 0.0915724337f,
+  0.0971438363f, 0.102476165f, 0.107494824f, 0.112126775f, 0.116302274f, 0.119956627f,
+  0.12303178f, 0.125477955f, 0.127254978f, 0.128333211f, 0.128694683f, 0.128333211f,
+  0.127254978f, 0.125477955f, 0.12303178f, 0.119956627f, 0.116302274f, 0.112126775f,
+  0.107494824f, 0.102476165f, 0.0971438363f, 0.0915724337f, 0.0858363658f, 0.0800082907f,
+  0.074157618f, 0.0683492273f, 0.0626424253f, 0.0570900701f, 0.0517380051f, 0.0466246828f,
+  0.0357930996f, 0.03994257f, 0.0443230681f, 0.0489080772f, 0.0536646806f, 0.0585536025f,
+  0.063529551f, 0.0685417205f, 0.0735345334f, 0.0784485191f, 0.0832214504f, 0.0877895579f,
+  0.0920889825f, 0.0960570946f, 0.0996341705f, 0.10276477f, 0.105399221f, 0.107494824f,
+  0.109017141f, 0.109940879f, 0.11025051f, 0.109940879f, 0.109017141f, 0.107494824f,
+  0.105399221f, 0.10276477f, 0.0996341705f, 0.0960570946f, 0.0920889825f, 0.0877895579f,
+  0.0832214504f, 0.0784485191f, 0.0735345334f, 0.0685417205f, 0.063529551f, 0.0585536025f,
+  0.0536646806f, 0.0489080772f, 0.0443230681f, 0.03994257f, 0.030491339f, 0.034026172f,
+  0.0377578177f, 0.0416636951f, 0.0457157418f, 0.0498805046f, 0.0541194007f, 0.0583891571f,
+  0.0626424253f, 0.0668285415f, 0.0708944872f, 0.0747859627f, 0.0784485191f, 0.0818288699f,
+  0.0848761201f, 0.0875430107f, 0.089787215f, 0.0915724337f, 0.0928692594f, 0.093656145f,
+  0.0939199403f, 0.093656145f, 0.0928692594f, 0.0915724337f, 0.089787215f, 0.0875430107f,
+  0.0848761201f, 0.0818288699f, 0.0784485191f, 0.0747859627f, 0.0708944872f, 0.0668285415f,
+  0.0626424253f, 0.0583891571f, 0.0541194007f, 0.0498805046f, 0.0457157418f, 0.0416636951f,
+  0.0377578177f, 0.034026172f, 0.0258291848f, 0.0288235452f, 0.0319846198f, 0.0352932848f,
+  0.038725771f, 0.0422537252f, 0.0458444916f, 0.0494613983f, 0.0530643351f, 0.0566103905f,
+  0.0600546673f, 0.063351132f, 0.0664536804f, 0.0693171695f, 0.0718984753f, 0.074157618f,
+  0.0760586858f, 0.0775709227f, 0.078669481f, 0.0793360546f, 0.0795595124f, 0.0793360546f,
+  0.078669481f, 0.0775709227f, 0.0760586858f, 0.074157618f, 0.0718984753f, 0.0693171695f,
+  0.0664536804f, 0.063351132f, 0.0600546673f, 0.0566103905f, 0.0530643351f, 0.0494613983f,
+  0.0458444916f, 0.0422537252f, 0.038725771f, 0.0352932848f, 0.0319846198f, 0.0288235452f,
+  0.0217571538f, 0.0242794473f, 0.0269421712f, 0.0297292098f, 0.0326205529f, 0.0355923288f,
+  0.038617f, 0.0416636951f, 0.0446986221f, 0.0476856306f, 0.0505868979f, 0.0533636659f,
+  0.0559771061f, 0.0583891571f, 0.0605635159f, 0.0624664798f, 0.0640678555f, 0.0653416812f,
+  0.0662670359f, 0.0668285415f, 0.0670167506f, 0.0668285415f, 0.0662670359f, 0.0653416812f,
+  0.0640678555f, 0.0624664798f, 0.0605635159f, 0.0583891571f, 0.0559771061f, 0.0533636659f,
+  0.0505868979f, 0.0476856306f, 0.0446986221f, 0.0416636951f, 0.038617f, 0.0355923288f,
+  0.0326205529f, 0.0297292098f, 0.0269421712f, 0.0242794473f, 0.0182242878f, 0.0203370173f,
+  0.022567369f, 0.0249018632f, 0.0273237191f, 0.0298129432f, 0.0323464796f, 0.0348984599f,
+  0.0374405831f, 0.03994257f, 0.0423727371f, 0.0446986221f, 0.0468876883f, 0.0489080772f,
+  0.0507293791f, 0.0523233451f, 0.0536646806f, 0.0547316819f, 0.055506777f, 0.0559771061f,
+  0.0561347567f, 0.0559771061f, 0.055506777f, 0.0547316819f, 0.0536646806f, 0.0523233451f,
+  0.0507293791f, 0.0489080772f, 0.0468876883f, 0.0446986221f, 0.0423727371f, 0.03994257f,
+  0.0374405831f, 0.0348984599f, 0.0323464796f, 0.0298129432f, 0.0273237191f, 0.0249018632f,
+  0.022567369f, 0.0203370173f, 0.0151794488f, 0.0169391967f, 0.0187969115f, 0.0207413677f,
+  0.0227585901f, 0.0248319265f, 0.0269421712f, 0.0290677771f, 0.0311851725f, 0.0332691409f,
+  0.0352932848f, 0.0372305699f, 0.0390538946f, 0.0407367274f, 0.0422537252f, 0.0435813889f,
+  0.0446986221f, 0.0455873385f, 0.0462329462f, 0.0466246828f, 0.0467560068f, 0.0466246828f,
+  0.0462329462f, 0.0455873385f, 0.0446986221f, 0.0435813889f, 0.0422537252f, 0.0407367274f,
+  0.0390538946f, 0.0372305699f, 0.0352932848f, 0.0332691409f, 0.0311851725f, 0.0290677771f,
+  0.0269421712f, 0.0248319265f, 0.0227585901f, 0.0207413677f, 0.0187969115f, 0.0169391967f,
+  0.0125724133f, 0.0140299285f, 0.0155685814f, 0.0171790849f, 0.0188498553f, 0.0205670968f,
+  0.0223149098f, 0.0240754467f, 0.0258291848f, 0.0275552347f, 0.0292317439f, 0.0308363046f,
+  0.0323464796f, 0.0337402895f, 0.0349967442f, 0.0360963866f, 0.0370217338f, 0.0377578177f,
+  0.0382925458f, 0.038617f, 0.038725771f, 0.038617f, 0.0382925458f, 0.0377578177f,
+  0.0370217338f, 0.0360963866f, 0.0349967442f, 0.0337402895f, 0.0323464796f, 0.0308363046f,
+  0.0292317439f, 0.0275552347f, 0.0258291848f, 0.0240754467f, 0.0223149098f, 0.0205670968f,
+  0.0188498553f, 0.0171790849f, 0.0155685814f, 0.0140299285f, 0.0103547238f, 0.0115551371f,
+  0.0128223877f, 0.0141488025f, 0.0155248586f, 0.0169391967f, 0.0183787029f, 0.0198286939f,
+  0.021273084f, 0.0226946697f, 0.0240754467f, 0.0253969803f, 0.0266407691f, 0.0277887192f,
+  0.0288235452f, 0.0297292098f, 0.030491339f, 0.0310975835f, 0.0315379873f, 0.0318052098f,
+  0.0318947844f, 0.0318052098f, 0.0315379873f, 0.0310975835f, 0.030491339f, 0.0297292098f,
+  0.0288235452f, 0.0277887192f, 0.0266407691f, 0.0253969803f, 0.0240754467f, 0.0226946697f,
+  0.021273084f, 0.0198286939f, 0.0183787029f, 0.0169391967f, 0.0155248586f, 0.0141488025f,
+  0.0128223877f, 0.0115551371f, 0.00848038029f, 0.00946350303f, 0.0105013642f, 0.0115876803f,
+  0.0127146523f, 0.0138729764f, 0.0150519162f, 0.0162394363f, 0.0174223706f, 0.0185866319f,
+  0.0197174698f, 0.0207997821f, 0.0218184348f, 0.0227585901f, 0.0236060992f, 0.024347825f,
+  0.0249720011f, 0.0254685059f, 0.0258291848f, 0.0260480437f, 0.026121404f, 0.0260480437f,
+  0.0258291848f, 0.0254685059f, 0.0249720011f, 0.024347825f, 0.0236060992f, 0.0227585901f,
+  0.0218184348f, 0.0207997821f, 0.0197174698f, 0.0185866319f, 0.0174223706f, 0.0162394363f,
+  0.0150519162f, 0.0138729764f, 0.0127146523f, 0.0115876803f, 0.0105013642f, 0.00946350303f,
+  0.00690635899f, 0.00770700676f, 0.00855223369f, 0.00943692587f, 0.0103547238f, 0.0112980492f,
+  0.0122581692f, 0.0132252825f, 0.0141886566f, 0.0151368184f, 0.0160577651f, 0.0169391967f,
+  0.017768776f, 0.0185344312f, 0.0192246363f, 0.0198286939f, 0.0203370173f, 0.0207413677f,
+  0.0210351013f, 0.0212133396f, 0.021273084f, 0.0212133396f, 0.0210351013f, 0.0207413677f,
+  0.0203370173f, 0.0198286939f, 0.0192246363f, 0.0185344312f, 0.017768776f, 0.0169391967f,
+  0.0160577651f, 0.0151368184f, 0.0141886566f, 0.0132252825f, 0.0122581692f, 0.0112980492f,
+  0.0103547238f, 0.00943692587f, 0.00855223369f, 0.00770700676f,
+};
+
+/* (dx, dy) of each TTA shift */
+static const int tta_shifts[TTA_NUM_SHIFTS][2] = {
+  { -2, 0 },
+  { 2, 0 },
+  { 0, -2 },
+  { 0, 2 },
+};
+
+/* Source pixel of every output pixel for each TTA rotation, then each shift */
+static const unsigned short tta_remap[TTA_NUM_REMAPS][FT_NN_INPUT_SIZE] = {
+  {
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 67, 68, 69, 70,
+    71, 72, 113, 113, 114, 115, 116, 117, 158, 159, 159, 159,
+    159, 199, 199, 199, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 61, 62, 62, 63, 64, 65,
+    106, 107, 108, 109, 110, 111, 152, 153, 154, 155, 156, 157,
+    198, 199, 199, 199, 199, 239, 239, 239, 7, 8, 9, 10,
+    10, 11, 12, 13, 14, 55, 56, 57, 58, 59, 100, 101,
+    102, 103, 104, 105, 146, 147, 148, 149, 150, 151, 192, 193,
+    194, 195, 196, 197, 238, 239, 239, 239, 239, 239, 279, 279,
+    6, 7, 8, 49, 50, 51, 52, 53, 54, 95, 96, 97,
+    98, 99, 100, 141, 142, 143, 144, 145, 186, 187, 188, 189,
+    190, 191, 232, 233, 234, 235, 236, 237, 278, 279, 279, 279,
+    279, 279, 319, 319, 46, 47, 48, 89, 90, 91, 92, 93,
+    94, 135, 136, 137, 138, 139, 140, 181, 182, 183, 184, 185,
+    226, 227, 228, 229, 230, 231, 272, 273, 274, 275, 276, 277,
+    318, 319, 319, 319, 319, 319, 359, 359, 86, 87, 88, 129,
+    130, 131, 132, 133, 134, 175, 176, 177, 178, 179, 180, 221,
+    222, 223, 224, 225, 266, 267, 268, 269, 270, 271, 312, 313,
+    314, 315, 316, 317, 358, 359, 359, 359, 359, 359, 399, 399,
+    126, 127, 128, 169, 170, 171, 172, 173, 174, 215, 216, 217,
+    218, 219, 220, 261, 262, 263, 264, 265, 266, 307, 308, 309,
+    309, 310, 351, 352, 353, 354, 355, 356, 397, 398, 399, 399,
+    399, 399, 439, 439, 166, 167, 168, 209, 210, 211, 212, 213,
+    214, 255, 256, 257, 258, 258, 259, 300, 301, 302, 303, 304,
+    305, 346, 347, 348, 349, 350, 391, 392, 393, 394, 395, 396,
+    437, 438, 439, 439, 439, 439, 479, 479, 206, 206, 207, 248,
+    249, 250, 251, 252, 253, 294, 295, 296, 297, 298, 299, 340,
+    341, 342, 343, 344, 345, 386, 387, 388, 389, 390, 391, 432,
+    433, 434, 435, 436, 477, 478, 479, 479, 479, 479, 519, 519,
+    245, 246, 247, 248, 289, 290, 291, 292, 293, 334, 335, 336,
+    337, 338, 339, 380, 381, 382, 383, 384, 385, 426, 427, 428,
+    429, 430, 431, 472, 473, 474, 475, 476, 517, 518, 519, 519,
+    519, 519, 559, 559, 285, 286, 287, 288, 329, 330, 331, 332,
+    333, 374, 375, 376, 377, 378, 379, 420, 421, 422, 423, 424,
+    425, 466, 467, 468, 469, 470, 471, 512, 513, 514, 515, 516,
+    557, 558, 559, 559, 559, 559, 599, 599, 325, 326, 327, 328,
+    369, 370, 371, 372, 373, 414, 415, 416, 417, 418, 419, 460,
+    461, 462, 463, 464, 465, 506, 507, 508, 509, 510, 511, 552,
+    553, 554, 555, 556, 557, 597, 598, 599, 599, 599, 639, 639,
+    365, 366, 367, 368, 409, 410, 411, 412, 413, 414, 455, 456,
+    457, 458, 459, 500, 501, 502, 503, 504, 505, 545, 546, 547,
+    548, 549, 550, 591, 592, 593, 594, 595, 596, 637, 638, 639,
+    639, 639, 679, 679, 405, 406, 407, 408, 449, 450, 451, 452,
+    453, 454, 494, 495, 496, 497, 498, 539, 540, 541, 542, 543,
+    544, 585, 586, 587, 588, 589, 590, 631, 632, 633, 634, 635,
+    636, 677, 678, 679, 679, 679, 719, 719, 444, 445, 446, 447,
+    488, 489, 490, 491, 492, 493, 534, 535, 536, 537, 538, 539,
+    580, 581, 582, 583, 584, 625, 626, 627, 628, 629, 630, 671,
+    672, 673, 674, 675, 676, 717, 718, 719, 719, 719, 719, 759,
+    484, 485, 486, 487, 528, 529, 530, 531, 532, 533, 574, 575,
+    576, 577, 578, 579, 620, 621, 622, 623, 624, 665, 666, 667,
+    668, 669, 670, 711, 712, 713, 714, 715, 716, 757, 758, 759,
+    759, 759, 759, 799, 524, 525, 526, 527, 568, 569, 570, 571,
+    572, 573, 614, 615, 616, 617, 618, 619, 660, 661, 662, 663,
+    664, 705, 706, 707, 708, 709, 710, 751, 752, 753, 754, 755,
+    756, 797, 798, 799, 799, 799, 799, 839, 564, 565, 566, 567,
+    608, 609, 610, 611, 612, 613, 654, 655, 656, 657, 658, 659,
+    700, 701, 702, 703, 704, 705, 746, 747, 748, 749, 750, 791,
+    792, 793, 793, 794, 795, 836, 837, 838, 839, 839, 839, 879,
+    604, 605, 606, 607, 648, 649, 650, 651, 652, 653, 694, 695,
+    696, 697, 698, 699, 740, 741, 742, 742, 743, 744, 785, 786,
+    787, 788, 789, 830, 831, 832, 833, 834, 835, 876, 877, 878,
+    879, 879, 879, 919, 644, 645, 646, 647, 688, 689, 690, 690,
+    691, 692, 733, 734, 735, 736, 737, 738, 779, 780, 781, 782,
+    783, 784, 825, 826, 827, 828, 829, 870, 871, 872, 873, 874,
+    875, 916, 917, 918, 919, 919, 919, 959, 683, 684, 685, 686,
+    687, 728, 729, 730, 731, 732, 773, 774, 775, 776, 777, 778,
+    819, 820, 821, 822, 823, 824, 865, 866, 867, 868, 869, 870,
+    911, 912, 913, 914, 915, 956, 957, 958, 959, 959, 959, 999,
+    723, 724, 725, 726, 727, 768, 769, 770, 771, 772, 813, 814,
+    815, 816, 817, 818, 859, 860, 861, 862, 863, 864, 905, 906,
+    907, 908, 909, 910, 951, 952, 953, 954, 955, 996, 997, 998,
+    999, 999, 999, 1039, 763, 764, 765, 766, 767, 808, 809, 810,
+    811, 812, 853, 854, 855, 856, 857, 858, 899, 900, 901, 902,
+    903, 904, 945, 946, 947, 948, 949, 950, 991, 992, 993, 994,
+    995, 1036, 1037, 1038, 1039, 1039, 1039, 1079, 803, 804, 805, 806,
+    807, 848, 849, 850, 851, 852, 853, 894, 895, 896, 897, 898,
+    939, 940, 941, 942, 943, 944, 985, 986, 987, 988, 989, 989,
+    1030, 1031, 1032, 1033, 1034, 1035, 1076, 1077, 1078, 1079, 1079, 1119,
+    843, 844, 845, 846, 847, 888, 889, 890, 891, 892, 893, 934,
+    935, 936, 937, 938, 978, 979, 980, 981, 982, 983, 1024, 1025,
+    1026, 1027, 1028, 1029, 1070, 1071, 1072, 1073, 1074, 1075, 1116, 1117,
+    1118, 1119, 1119, 1159, 883, 884, 885, 886, 887, 927, 928, 929,
+    930, 931, 932, 973, 974, 975, 976, 977, 1018, 1019, 1020, 1021,
+    1022, 1023, 1064, 1065, 1066, 1067, 1068, 1069, 1110, 1111, 1112, 1113,
+    1114, 1115, 1156, 1157, 1158, 1159, 1159, 1159, 922, 923, 924, 925,
+    926, 967, 968, 969, 970, 971, 972, 1013, 1014, 1015, 1016, 1017,
+    1018, 1059, 1060, 1061, 1062, 1063, 1104, 1105, 1106, 1107, 1108, 1109,
+    1150, 1151, 1152, 1153, 1154, 1155, 1196, 1197, 1198, 1199, 1199, 1199,
+    962, 963, 964, 965, 966, 1007, 1008, 1009, 1010, 1011, 1012, 1053,
+    1054, 1055, 1056, 1057, 1058, 1099, 1100, 1101, 1102, 1103, 1144, 1145,
+    1146, 1147, 1148, 1149, 1190, 1191, 1192, 1193, 1194, 1195, 1236, 1237,
+    1238, 1239, 1239, 1239, 1002, 1003, 1004, 1005, 1006, 1047, 1048, 1049,
+    1050, 1051, 1052, 1093, 1094, 1095, 1096, 1097, 1098, 1139, 1140, 1141,
+    1142, 1143, 1144, 1185, 1186, 1187, 1188, 1189, 1230, 1231, 1232, 1233,
+    1234, 1235, 1276, 1277, 1277, 1278, 1279, 1279, 1042, 1043, 1044, 1045,
+    1046, 1087, 1088, 1089, 1090, 1091, 1092, 1133, 1134, 1135, 1136, 1137,
+    1138, 1179, 1180, 1181, 1182, 1183, 1184, 1225, 1226, 1226, 1227, 1228,
+    1269, 1270, 1271, 1272, 1273, 1274, 1315, 1316, 1317, 1318, 1319, 1319,
+    1082, 1083, 1084, 1085, 1086, 1127, 1128, 1129, 1130, 1131, 1132, 1173,
+    1174, 1174, 1175, 1176, 1177, 1218, 1219, 1220, 1221, 1222, 1223, 1264,
+    1265, 1266, 1267, 1268, 1309, 1310, 1311, 1312, 1313, 1314, 1355, 1356,
+    1357, 1358, 1359, 1359, 1122, 1123, 1123, 1124, 1125, 1166, 1167, 1168,
+    1169, 1170, 1171, 1212, 1213, 1214, 1215, 1216, 1217, 1258, 1259, 1260,
+    1261, 1262, 1263, 1304, 1305, 1306, 1307, 1308, 1309, 1350, 1351, 1352,
+    1353, 1354, 1395, 1396, 1397, 1398, 1399, 1399, 1161, 1162, 1163, 1164,
+    1165, 1166, 1207, 1208, 1209, 1210, 1211, 1252, 1253, 1254, 1255, 1256,
+    1257, 1298, 1299, 1300, 1301, 1302, 1303, 1344, 1345, 1346, 1347, 1348,
+    1349, 1390, 1391, 1392, 1393, 1394, 1435, 1436, 1437, 1438, 1439, 1439,
+    1201, 1202, 1203, 1204, 1205, 1206, 1247, 1248, 1249, 1250, 1251, 1292,
+    1293, 1294, 1295, 1296, 1297, 1338, 1339, 1340, 1341, 1342, 1343, 1384,
+    1385, 1386, 1387, 1388, 1389, 1430, 1431, 1432, 1433, 1434, 1475, 1476,
+    1477, 1478, 1479, 1479, 1241, 1242, 1243, 1244, 1245, 1246, 1287, 1288,
+    1289, 1290, 1291, 1292, 1333, 1334, 1335, 1336, 1337, 1378, 1379, 1380,
+    1381, 1382, 1383, 1424, 1425, 1426, 1427, 1428, 1429, 1470, 1471, 1472,
+    1473, 1473, 1474, 1515, 1516, 1517, 1518, 1519, 1281, 1282, 1283, 1284,
+    1285, 1286, 1327, 1328, 1329, 1330, 1331, 1332, 1373, 1374, 1375, 1376,
+    1377, 1418, 1419, 1420, 1421, 1422, 1422, 1463, 1464, 1465, 1466, 1467,
+    1468, 1509, 1510, 1511, 1512, 1513, 1514, 1555, 1556, 1557, 1558, 1559,
+    1321, 1322, 1323, 1324, 1325, 1326, 1367, 1368, 1369, 1370, 1370, 1371,
+    1412, 1413, 1414, 1415, 1416, 1457, 1458, 1459, 1460, 1461, 1462, 1503,
+    1504, 1505, 1506, 1507, 1508, 1549, 1550, 1551, 1552, 1553, 1554, 1595,
+    1596, 1597, 1598, 1599, 1360, 1361, 1362, 1363, 1364, 1365, 1406, 1407,
+    1408, 1409, 1410, 1411, 1452, 1453, 1454, 1455, 1456, 1457, 1498, 1499,
+    1500, 1501, 1502, 1543, 1544, 1545, 1546, 1547, 1548, 1589, 1590, 1591,
+    1592, 1593, 1594, 1635, 1636, 1637, 1638, 1639, 1400, 1401, 1402, 1403,
+    1404, 1405, 1446, 1447, 1448, 1449, 1450, 1451, 1492, 1493, 1494, 1495,
+    1496, 1497, 1538, 1539, 1540, 1541, 1542, 1583, 1584, 1585, 1586, 1587,
+    1588, 1629, 1630, 1631, 1632, 1633, 1634, 1675, 1676, 1677, 1678, 1679,
+    1440, 1441, 1442, 1443, 1444, 1445, 1486, 1487, 1488, 1489, 1490, 1491,
+    1532, 1533, 1534, 1535, 1536, 1537, 1578, 1579, 1580, 1581, 1582, 1623,
+    1624, 1625, 1626, 1627, 1628, 1669, 1670, 1671, 1672, 1673, 1674, 1715,
+    1716, 1717, 1718, 1719, 1440, 1481, 1482, 1483, 1484, 1485, 1526, 1527,
+    1528, 1529, 1530, 1531, 1572, 1573, 1574, 1575, 1576, 1577, 1618, 1619,
+    1620, 1621, 1622, 1623, 1664, 1665, 1666, 1667, 1668, 1709, 1710, 1710,
+    1711, 1712, 1713, 1754, 1755, 1756, 1757, 1758, 1480, 1521, 1522, 1523,
+    1524, 1525, 1566, 1567, 1568, 1569, 1570, 1571, 1612, 1613, 1614, 1615,
+    1616, 1617, 1658, 1658, 1659, 1660, 1661, 1662, 1703, 1704, 1705, 1706,
+    1707, 1748, 1749, 1750, 1751, 1752, 1753, 1794, 1795, 1796, 1797, 1798,
+    1520, 1561, 1562, 1563, 1564, 1565, 1606, 1607, 1607, 1608, 1609, 1610,
+    1651, 1652, 1653, 1654, 1655, 1656, 1697, 1698, 1699, 1700, 1701, 1702,
+    1743, 1744, 1745, 1746, 1747, 1788, 1789, 1790, 1791, 1792, 1793, 1834,
+    1835, 1836, 1837, 1838, 1560, 1600, 1601, 1602, 1603, 1604, 1605, 1646,
+    1647, 1648, 1649, 1650, 1691, 1692, 1693, 1694, 1695, 1696, 1737, 1738,
+    1739, 1740, 1741, 1742, 1783, 1784, 1785, 1786, 1787, 1788, 1829, 1830,
+    1831, 1832, 1833, 1874, 1875, 1876, 1877, 1878, 1600, 1640, 1641, 1642,
+    1643, 1644, 1645, 1686, 1687, 1688, 1689, 1690, 1731, 1732, 1733, 1734,
+    1735, 1736, 1777, 1778, 1779, 1780, 1781, 1782, 1823, 1824, 1825, 1826,
+    1827, 1828, 1869, 1870, 1871, 1872, 1873, 1914, 1915, 1916, 1917, 1918,
+    1640, 1680, 1681, 1682, 1683, 1684, 1685, 1726, 1727, 1728, 1729, 1730,
+    1771, 1772, 1773, 1774, 1775, 1776, 1817, 1818, 1819, 1820, 1821, 1822,
+    1863, 1864, 1865, 1866, 1867, 1868, 1909, 1910, 1911, 1912, 1913, 1914,
+    1955, 1956, 1957, 1957, 1680, 1720, 1721, 1722, 1723, 1724, 1725, 1766,
+    1767, 1768, 1769, 1770, 1771, 1812, 1813, 1814, 1815, 1816, 1857, 1858,
+    1859, 1860, 1861, 1862, 1903, 1904, 1905, 1906, 1906, 1907, 1948, 1949,
+    1950, 1951, 1952, 1953, 1994, 1995, 1996, 1997, 1720, 1760, 1761, 1762,
+    1763, 1764, 1765, 1806, 1807, 1808, 1809, 1810, 1811, 1852, 1853, 1854,
+    1854, 1855, 1896, 1897, 1898, 1899, 1900, 1901, 1942, 1943, 1944, 1945,
+    1946, 1947, 1988, 1989, 1990, 1991, 1992, 1993, 2034, 2035, 2036, 2037,
+    1760, 1800, 1801, 1802, 1803, 1803, 1804, 1845, 1846, 1847, 1848, 1849,
+    1850, 1891, 1892, 1893, 1894, 1895, 1936, 1937, 1938, 1939, 1940, 1941,
+    1982, 1983, 1984, 1985, 1986, 1987, 2028, 2029, 2030, 2031, 2032, 2033,
+    2074, 2075, 2076, 2077, 1800, 1840, 1840, 1841, 1842, 1843, 1844, 1885,
+    1886, 1887, 1888, 1889, 1890, 1931, 1932, 1933, 1934, 1935, 1936, 1977,
+    1978, 1979, 1980, 1981, 2022, 2023, 2024, 2025, 2026, 2027, 2068, 2069,
+    2070, 2071, 2072, 2073, 2114, 2115, 2116, 2117, 1840, 1880, 1880, 1881,
+    1882, 1883, 1884, 1925, 1926, 1927, 1928, 1929, 1930, 1971, 1972, 1973,
+    1974, 1975, 1976, 2017, 2018, 2019, 2020, 2021, 2062, 2063, 2064, 2065,
+    2066, 2067, 2108, 2109, 2110, 2111, 2112, 2113, 2154, 2155, 2156, 2157,
+    1880, 1920, 1920, 1921, 1922, 1923, 1924, 1965, 1966, 1967, 1968, 1969,
+    1970, 2011, 2012, 2013, 2014, 2015, 2016, 2057, 2058, 2059, 2060, 2061,
+    2062, 2103, 2104, 2105, 2106, 2107, 2148, 2149, 2150, 2151, 2152, 2153,
+    2193, 2194, 2195, 2196, 1920, 1920, 1960, 1961, 1962, 1963, 1964, 2005,
+    2006, 2007, 2008, 2009, 2010, 2051, 2052, 2053, 2054, 2055, 2056, 2097,
+    2098, 2099, 2100, 2101, 2102, 2142, 2143, 2144, 2145, 2146, 2187, 2188,
+    2189, 2190, 2191, 2192, 2233, 2234, 2235, 2236, 1960, 1960, 2000, 2001,
+    2002, 2003, 2004, 2045, 2046, 2047, 2048, 2049, 2050, 2091, 2091, 2092,
+    2093, 2094, 2095, 2136, 2137, 2138, 2139, 2140, 2141, 2182, 2183, 2184,
+    2185, 2186, 2227, 2228, 2229, 2230, 2231, 2232, 2273, 2274, 2275, 2276,
+    2000, 2000, 2040, 2040, 2041, 2042, 2043, 2044, 2085, 2086, 2087, 2088,
+    2089, 2130, 2131, 2132, 2133, 2134, 2135, 2176, 2177, 2178, 2179, 2180,
+    2181, 2222, 2223, 2224, 2225, 2226, 2227, 2268, 2269, 2270, 2271, 2272,
+    2313, 2314, 2315, 2316, 2040, 2040, 2080, 2080, 2081, 2082, 2083, 2084,
+    2125, 2126, 2127, 2128, 2129, 2170, 2171, 2172, 2173, 2174, 2175, 2216,
+    2217, 2218, 2219, 2220, 2221, 2262, 2263, 2264, 2265, 2266, 2267, 2308,
+    2309, 2310, 2311, 2312, 2353, 2354, 2355, 2356, 2080, 2080, 2120, 2120,
+    2121, 2122, 2123, 2124, 2165, 2166, 2167, 2168, 2169, 2210, 2211, 2212,
+    2213, 2214, 2215, 2256, 2257, 2258, 2259, 2260, 2261, 2302, 2303, 2304,
+    2305, 2306, 2307, 2348, 2349, 2350, 2351, 2352, 2393, 2394, 2395, 2396,
+    2120, 2120, 2160, 2160, 2161, 2162, 2163, 2164, 2205, 2206, 2207, 2208,
+    2209, 2210, 2251, 2252, 2253, 2254, 2255, 2296, 2297, 2298, 2299, 2300,
+    2301, 2342, 2343, 2344, 2345, 2346, 2347, 2388, 2389, 2390, 2390, 2391,
+    2392, 2433, 2434, 2435, 2160, 2160, 2200, 2200, 2201, 2202, 2203, 2204,
+    2245, 2246, 2247, 2248, 2249, 2250, 2291, 2292, 2293, 2294, 2295, 2336,
+    2337, 2338, 2338, 2339, 2340, 2381, 2382, 2383, 2384, 2385, 2386, 2427,
+    2428, 2429, 2430, 2431, 2432, 2473, 2474, 2475, 2200, 2200, 2240, 2240,
+    2241, 2242, 2243, 2244, 2285, 2286, 2287, 2287, 2288, 2289, 2330, 2331,
+    2332, 2333, 2334, 2375, 2376, 2377, 2378, 2379, 2380, 2421, 2422, 2423,
+    2424, 2425, 2426, 2467, 2468, 2469, 2470, 2471, 2472, 2513, 2514, 2515,
+    2240, 2240, 2280, 2280, 2280, 2281, 2282, 2283, 2324, 2325, 2326, 2327,
+    2328, 2329, 2370, 2371, 2372, 2373, 2374, 2375, 2416, 2417, 2418, 2419,
+    2420, 2461, 2462, 2463, 2464, 2465, 2466, 2507, 2508, 2509, 2510, 2511,
+    2512, 2553, 2554, 2555, 2280, 2280, 2320, 2320, 2320, 2321, 2322, 2323,
+    2364, 2365, 2366, 2367, 2368, 2369, 2410, 2411, 2412, 2413, 2414, 2415,
+    2456, 2457, 2458, 2459, 2460, 2501, 2502, 2503, 2504, 2505, 2506, 2547,
+    2548, 2549, 2550, 2551, 2552, 2593, 2594, 2595, 2320, 2320, 2360, 2360,
+    2360, 2361, 2362, 2363, 2404, 2405, 2406, 2407, 2408, 2409, 2450, 2451,
+    2452, 2453, 2454, 2455, 2496, 2497, 2498, 2499, 2500, 2541, 2542, 2543,
+    2544, 2545, 2546, 2587, 2588, 2589, 2590, 2591, 2592, 2633, 2634, 2635,
+    2360, 2360, 2360, 2400, 2400, 2401, 2402, 2403, 2444, 2445, 2446, 2447,
+    2448, 2449, 2490, 2491, 2492, 2493, 2494, 2495, 2536, 2537, 2538, 2539,
+    2540, 2541, 2582, 2583, 2584, 2585, 2586, 2626, 2627, 2628, 2629, 2630,
+    2631, 2672, 2673, 2674, 2400, 2400, 2400, 2440, 2440, 2441, 2442, 2443,
+    2484, 2485, 2486, 2487, 2488, 2489, 2530, 2531, 2532, 2533, 2534, 2535,
+    2575, 2576, 2577, 2578, 2579, 2580, 2621, 2622, 2623, 2624, 2625, 2666,
+    2667, 2668, 2669, 2670, 2671, 2712, 2713, 2714, 2440, 2440, 2440, 2480,
+    2480, 2481, 2482, 2483, 2523, 2524, 2525, 2526, 2527, 2528, 2569, 2570,
+    2571, 2572, 2573, 2574, 2615, 2616, 2617, 2618, 2619, 2620, 2661, 2662,
+    2663, 2664, 2665, 2666, 2707, 2708, 2709, 2710, 2711, 2752, 2753, 2754,
+    2480, 2480, 2480, 2520, 2520, 2520, 2521, 2522, 2523, 2564, 2565, 2566,
+    2567, 2568, 2609, 2610, 2611, 2612, 2613, 2614, 2655, 2656, 2657, 2658,
+    2659, 2660, 2701, 2702, 2703, 2704, 2705, 2706, 2747, 2748, 2749, 2750,
+    2751, 2792, 2793, 2794, 2520, 2520, 2520, 2560, 2560, 2560, 2561, 2562,
+    2563, 2604, 2605, 2606, 2607, 2608, 2649, 2650, 2651, 2652, 2653, 2654,
+    2695, 2696, 2697, 2698, 2699, 2700, 2741, 2742, 2743, 2744, 2745, 2746,
+    2787, 2788, 2789, 2790, 2791, 2832, 2833, 2834, 2560, 2560, 2560, 2600,
+    2600, 2600, 2601, 2602, 2603, 2644, 2645, 2646, 2647, 2648, 2689, 2690,
+    2691, 2692, 2693, 2694, 2735, 2736, 2737, 2738, 2739, 2740, 2781, 2782,
+    2783, 2784, 2785, 2786, 2827, 2828, 2829, 2830, 2831, 2832, 2873, 2874,
+    2600, 2600, 2600, 2640, 2640, 2640, 2641, 2642, 2643, 2684, 2685, 2686,
+    2687, 2688, 2689, 2730, 2731, 2732, 2733, 2734, 2775, 2776, 2777, 2778,
+    2779, 2780, 2821, 2822, 2822, 2823, 2824, 2825, 2866, 2867, 2868, 2869,
+    2870, 2871, 2912, 2913, 2640, 2640, 2640, 2680, 2680, 2680, 2681, 2682,
+    2683, 2724, 2725, 2726, 2727, 2728, 2729, 2770, 2771, 2771, 2772, 2773,
+    2814, 2815, 2816, 2817, 2818, 2819, 2860, 2861, 2862, 2863, 2864, 2865,
+    2906, 2907, 2908, 2909, 2910, 2911, 2952, 2953, 2680, 2680, 2680, 2720,
+    2720, 2720, 2720, 2721, 2722, 2763, 2764, 2765, 2766, 2767, 2768, 2809,
+    2810, 2811, 2812, 2813, 2814, 2855, 2856, 2857, 2858, 2859, 2900, 2901,
+    2902, 2903, 2904, 2905, 2946, 2947, 2948, 2949, 2950, 2951, 2992, 2993,
+    2720, 2720, 2720, 2760, 2760, 2760, 2760, 2761, 2762, 2803, 2804, 2805,
+    2806, 2807, 2808, 2849, 2850, 2851, 2852, 2853, 2854, 2895, 2896, 2897,
+    2898, 2899, 2940, 2941, 2942, 2943, 2944, 2945, 2986, 2987, 2988, 2989,
+    2990, 2991, 3032, 3033, 2760, 2760, 2760, 2800, 2800, 2800, 2800, 2801,
+    2802, 2843, 2844, 2845, 2846, 2847, 2848, 2889, 2890, 2891, 2892, 2893,
+    2894, 2935, 2936, 2937, 2938, 2939, 2980, 2981, 2982, 2983, 2984, 2985,
+    3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 2800, 2800, 2800, 2840,
+    2840, 2840, 2840, 2841, 2842, 2883, 2884, 2885, 2886, 2887, 2888, 2929,
+    2930, 2931, 2932, 2933, 2934, 2975, 2976, 2977, 2978, 2979, 2980, 3021,
+    3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3030, 3031, 3032,
+    2840, 2840, 2840, 2840, 2880, 2880, 2880, 2881, 2882, 2923, 2924, 2925,
+    2926, 2927, 2928, 2969, 2970, 2971, 2972, 2973, 2974, 3015, 3016, 3017,
+    3018, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028,
+    3029, 3030, 3031, 3032,
+  },
+  {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+    119, 119, 119, 119, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 56, 57, 58, 59, 60, 61, 62,
+    63, 64, 65, 66, 67, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 159, 159, 159, 159, 3, 4, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 96, 97, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 148, 149, 150,
+    151, 152, 153, 154, 155, 156, 157, 158, 199, 199, 199, 199,
+    43, 44, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+    95, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198,
+    239, 239, 239, 239, 83, 84, 125, 126, 127, 128, 129, 130,
+    131, 132, 133, 134, 135, 176, 177, 178, 179, 180, 181, 182,
+    183, 184, 185, 186, 187, 228, 229, 230, 231, 232, 233, 234,
+    235, 236, 237, 238, 279, 279, 279, 279, 123, 124, 165, 166,
+    167, 168, 169, 170, 171, 172, 173, 174, 175, 216, 217, 218,
+    219, 220, 221, 222, 223, 224, 225, 226, 227, 268, 269, 270,
+    271, 272, 273, 274, 275, 276, 277, 278, 319, 319, 319, 319,
+    163, 164, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+    215, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266,
+    267, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+    359, 359, 359, 359, 203, 204, 245, 246, 247, 248, 249, 250,
+    251, 252, 253, 254, 255, 296, 297, 298, 299, 300, 301, 302,
+    303, 304, 305, 306, 307, 348, 349, 350, 351, 352, 353, 354,
+    355, 356, 357, 358, 399, 399, 399, 399, 243, 244, 285, 286,
+    287, 288, 289, 290, 291, 292, 293, 294, 295, 336, 337, 338,
+    339, 340, 341, 342, 343, 344, 345, 346, 347, 388, 389, 390,
+    391, 392, 393, 394, 395, 396, 397, 398, 439, 439, 439, 439,
+    283, 284, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334,
+    335, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
+    387, 428, 429, 430, 430, 431, 432, 433, 434, 435, 436, 437,
+    478, 479, 479, 479, 323, 324, 365, 366, 367, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 467, 468, 469, 470, 471, 472, 473,
+    474, 475, 476, 477, 518, 519, 519, 519, 362, 363, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 456, 457,
+    458, 459, 460, 461, 462, 463, 464, 465, 466, 507, 508, 509,
+    510, 511, 512, 513, 514, 515, 516, 517, 518, 559, 559, 559,
+    402, 403, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    454, 455, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+    506, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557,
+    558, 599, 599, 599, 442, 443, 484, 485, 486, 487, 488, 489,
+    490, 491, 492, 493, 494, 495, 536, 537, 538, 539, 540, 541,
+    542, 543, 544, 545, 546, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 639, 639, 639, 482, 483, 524, 525,
+    526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 627, 628, 629,
+    630, 631, 632, 633, 634, 635, 636, 637, 638, 679, 679, 679,
+    522, 523, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573,
+    574, 575, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677,
+    678, 719, 719, 719, 562, 563, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 656, 657, 658, 659, 660, 661,
+    662, 663, 664, 665, 666, 707, 708, 709, 710, 711, 712, 713,
+    714, 715, 716, 717, 718, 759, 759, 759, 602, 603, 644, 645,
+    646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 696, 697,
+    698, 699, 700, 701, 702, 703, 704, 705, 706, 747, 748, 749,
+    750, 751, 752, 753, 754, 755, 756, 757, 758, 799, 799, 799,
+    642, 643, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693,
+    694, 695, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745,
+    746, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797,
+    798, 839, 839, 839, 682, 683, 724, 725, 726, 727, 728, 729,
+    730, 731, 732, 733, 734, 735, 776, 777, 778, 779, 780, 781,
+    782, 783, 784, 785, 786, 827, 828, 829, 830, 831, 832, 833,
+    834, 835, 836, 837, 838, 879, 879, 879, 722, 723, 724, 765,
+    766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 816, 817,
+    818, 819, 820, 821, 822, 823, 824, 825, 826, 867, 868, 869,
+    870, 871, 872, 873, 874, 875, 876, 877, 878, 919, 919, 919,
+    762, 763, 764, 805, 806, 807, 808, 809, 810, 811, 812, 813,
+    814, 815, 856, 857, 857, 858, 859, 860, 861, 862, 863, 864,
+    865, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916,
+    917, 958, 959, 959, 801, 802, 803, 844, 845, 846, 847, 848,
+    849, 850, 851, 852, 853, 854, 895, 896, 897, 898, 899, 900,
+    901, 902, 903, 904, 905, 906, 947, 948, 949, 950, 951, 952,
+    953, 954, 955, 956, 957, 998, 999, 999, 841, 842, 843, 884,
+    885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 935, 936,
+    937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 987, 988,
+    989, 990, 991, 992, 993, 994, 995, 996, 997, 1038, 1039, 1039,
+    881, 882, 883, 924, 925, 926, 927, 928, 929, 930, 931, 932,
+    933, 934, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984,
+    985, 986, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+    1037, 1078, 1079, 1079, 921, 922, 923, 964, 965, 966, 967, 968,
+    969, 970, 971, 972, 973, 974, 1015, 1016, 1017, 1018, 1019, 1020,
+    1021, 1022, 1023, 1024, 1025, 1026, 1067, 1068, 1069, 1070, 1071, 1072,
+    1073, 1074, 1075, 1076, 1077, 1118, 1119, 1119, 961, 962, 963, 1004,
+    1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1055, 1056,
+    1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1107, 1108,
+    1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1158, 1159, 1159,
+    1001, 1002, 1003, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
+    1053, 1054, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104,
+    1105, 1106, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156,
+    1157, 1198, 1199, 1199, 1041, 1042, 1043, 1084, 1085, 1086, 1087, 1088,
+    1089, 1090, 1091, 1092, 1093, 1094, 1135, 1136, 1137, 1138, 1139, 1140,
+    1141, 1142, 1143, 1144, 1145, 1146, 1187, 1188, 1189, 1190, 1191, 1192,
+    1193, 1194, 1195, 1196, 1197, 1238, 1239, 1239, 1081, 1082, 1083, 1124,
+    1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1175, 1176,
+    1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1227, 1228,
+    1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1278, 1279, 1279,
+    1121, 1122, 1123, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172,
+    1173, 1174, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+    1225, 1226, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
+    1277, 1318, 1319, 1319, 1161, 1162, 1163, 1204, 1205, 1206, 1207, 1208,
+    1209, 1210, 1211, 1212, 1213, 1214, 1255, 1256, 1257, 1258, 1259, 1260,
+    1261, 1262, 1263, 1264, 1265, 1266, 1307, 1308, 1309, 1310, 1311, 1312,
+    1313, 1314, 1315, 1316, 1317, 1358, 1359, 1359, 1201, 1202, 1203, 1244,
+    1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1296,
+    1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1347, 1347,
+    1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1397, 1398, 1399,
+    1241, 1242, 1243, 1284, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
+    1292, 1293, 1294, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+    1344, 1345, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395,
+    1396, 1437, 1438, 1439, 1280, 1281, 1282, 1323, 1324, 1325, 1326, 1327,
+    1328, 1329, 1330, 1331, 1332, 1333, 1334, 1375, 1376, 1377, 1378, 1379,
+    1380, 1381, 1382, 1383, 1384, 1385, 1426, 1427, 1428, 1429, 1430, 1431,
+    1432, 1433, 1434, 1435, 1436, 1437, 1478, 1479, 1320, 1321, 1322, 1363,
+    1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1415,
+    1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1466, 1467,
+    1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1518, 1519,
+    1360, 1361, 1362, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
+    1412, 1413, 1414, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463,
+    1464, 1465, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515,
+    1516, 1517, 1558, 1559, 1400, 1401, 1402, 1443, 1444, 1445, 1446, 1447,
+    1448, 1449, 1450, 1451, 1452, 1453, 1454, 1495, 1496, 1497, 1498, 1499,
+    1500, 1501, 1502, 1503, 1504, 1505, 1546, 1547, 1548, 1549, 1550, 1551,
+    1552, 1553, 1554, 1555, 1556, 1557, 1598, 1599, 1440, 1441, 1442, 1483,
+    1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1535,
+    1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1586, 1587,
+    1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1638, 1639,
+    1480, 1481, 1482, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
+    1532, 1533, 1534, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635,
+    1636, 1637, 1678, 1679, 1520, 1521, 1522, 1563, 1564, 1565, 1566, 1567,
+    1568, 1569, 1570, 1571, 1572, 1573, 1574, 1615, 1616, 1617, 1618, 1619,
+    1620, 1621, 1622, 1623, 1624, 1625, 1666, 1667, 1668, 1669, 1670, 1671,
+    1672, 1673, 1674, 1675, 1676, 1677, 1718, 1719, 1560, 1561, 1562, 1603,
+    1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1655,
+    1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1706, 1707,
+    1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1758, 1759,
+    1600, 1601, 1602, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651,
+    1652, 1653, 1654, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703,
+    1704, 1705, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755,
+    1756, 1757, 1798, 1799, 1640, 1641, 1642, 1643, 1684, 1685, 1686, 1687,
+    1688, 1689, 1690, 1691, 1692, 1693, 1694, 1735, 1736, 1737, 1738, 1739,
+    1740, 1741, 1742, 1743, 1744, 1745, 1786, 1787, 1788, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 1796, 1796, 1837, 1838, 1680, 1681, 1682, 1683,
+    1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1733, 1774,
+    1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1825, 1826,
+    1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1877, 1878,
+    1720, 1720, 1721, 1722, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770,
+    1771, 1772, 1773, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822,
+    1823, 1824, 1825, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874,
+    1875, 1876, 1917, 1918, 1760, 1760, 1761, 1762, 1803, 1804, 1805, 1806,
+    1807, 1808, 1809, 1810, 1811, 1812, 1813, 1854, 1855, 1856, 1857, 1858,
+    1859, 1860, 1861, 1862, 1863, 1864, 1865, 1906, 1907, 1908, 1909, 1910,
+    1911, 1912, 1913, 1914, 1915, 1916, 1957, 1958, 1800, 1800, 1801, 1802,
+    1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1894,
+    1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1946,
+    1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1997, 1998,
+    1840, 1840, 1841, 1842, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890,
+    1891, 1892, 1893, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942,
+    1943, 1944, 1945, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994,
+    1995, 1996, 2037, 2038, 1880, 1880, 1881, 1882, 1923, 1924, 1925, 1926,
+    1927, 1928, 1929, 1930, 1931, 1932, 1933, 1974, 1975, 1976, 1977, 1978,
+    1979, 1980, 1981, 1982, 1983, 1984, 1985, 2026, 2027, 2028, 2029, 2030,
+    2031, 2032, 2033, 2034, 2035, 2036, 2077, 2078, 1920, 1920, 1921, 1922,
+    1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 2014,
+    2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2066,
+    2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2117, 2118,
+    1960, 1960, 1961, 1962, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010,
+    2011, 2012, 2013, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062,
+    2063, 2064, 2065, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114,
+    2115, 2116, 2157, 2158, 2000, 2000, 2001, 2002, 2043, 2044, 2045, 2046,
+    2047, 2048, 2049, 2050, 2051, 2052, 2053, 2094, 2095, 2096, 2097, 2098,
+    2099, 2100, 2101, 2102, 2103, 2104, 2105, 2146, 2147, 2148, 2149, 2150,
+    2151, 2152, 2153, 2154, 2155, 2156, 2197, 2198, 2040, 2040, 2041, 2042,
+    2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2134,
+    2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2186,
+    2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2237, 2238,
+    2080, 2080, 2081, 2082, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130,
+    2131, 2132, 2133, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182,
+    2183, 2184, 2185, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234,
+    2235, 2236, 2277, 2278, 2120, 2120, 2121, 2122, 2163, 2164, 2165, 2166,
+    2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2215, 2216, 2217, 2218,
+    2219, 2220, 2221, 2222, 2223, 2223, 2224, 2265, 2266, 2267, 2268, 2269,
+    2270, 2271, 2272, 2273, 2274, 2275, 2316, 2317, 2160, 2160, 2160, 2161,
+    2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213,
+    2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2305,
+    2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2356, 2357,
+    2200, 2200, 2200, 2201, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249,
+    2250, 2251, 2252, 2253, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301,
+    2302, 2303, 2304, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353,
+    2354, 2355, 2356, 2397, 2240, 2240, 2240, 2241, 2282, 2283, 2284, 2285,
+    2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2334, 2335, 2336, 2337,
+    2338, 2339, 2340, 2341, 2342, 2343, 2344, 2385, 2386, 2387, 2388, 2389,
+    2390, 2391, 2392, 2393, 2394, 2395, 2396, 2437, 2280, 2280, 2280, 2281,
+    2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333,
+    2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2425,
+    2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2477,
+    2320, 2320, 2320, 2321, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369,
+    2370, 2371, 2372, 2373, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421,
+    2422, 2423, 2424, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473,
+    2474, 2475, 2476, 2517, 2360, 2360, 2360, 2361, 2402, 2403, 2404, 2405,
+    2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2454, 2455, 2456, 2457,
+    2458, 2459, 2460, 2461, 2462, 2463, 2464, 2505, 2506, 2507, 2508, 2509,
+    2510, 2511, 2512, 2513, 2514, 2515, 2516, 2557, 2400, 2400, 2400, 2401,
+    2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453,
+    2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2545,
+    2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2597,
+    2440, 2440, 2440, 2441, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489,
+    2490, 2491, 2492, 2493, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541,
+    2542, 2543, 2544, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593,
+    2594, 2595, 2596, 2637, 2480, 2480, 2480, 2481, 2522, 2523, 2524, 2525,
+    2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2574, 2575, 2576, 2577,
+    2578, 2579, 2580, 2581, 2582, 2583, 2584, 2625, 2626, 2627, 2628, 2629,
+    2630, 2631, 2632, 2633, 2634, 2635, 2636, 2677, 2520, 2520, 2520, 2521,
+    2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+    2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2665,
+    2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2717,
+    2560, 2560, 2560, 2561, 2562, 2603, 2604, 2605, 2606, 2607, 2608, 2609,
+    2610, 2611, 2612, 2613, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661,
+    2662, 2663, 2664, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713,
+    2713, 2714, 2715, 2756, 2600, 2600, 2600, 2601, 2602, 2643, 2644, 2645,
+    2646, 2647, 2648, 2649, 2650, 2650, 2651, 2652, 2693, 2694, 2695, 2696,
+    2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2745, 2746, 2747, 2748,
+    2749, 2750, 2751, 2752, 2753, 2754, 2755, 2796, 2640, 2640, 2640, 2640,
+    2641, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692,
+    2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744,
+    2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2836,
+    2680, 2680, 2680, 2680, 2681, 2722, 2723, 2724, 2725, 2726, 2727, 2728,
+    2729, 2730, 2731, 2732, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780,
+    2781, 2782, 2783, 2784, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832,
+    2833, 2834, 2835, 2876, 2720, 2720, 2720, 2720, 2721, 2762, 2763, 2764,
+    2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2813, 2814, 2815, 2816,
+    2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2865, 2866, 2867, 2868,
+    2869, 2870, 2871, 2872, 2873, 2874, 2875, 2916, 2760, 2760, 2760, 2760,
+    2761, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812,
+    2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864,
+    2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2956,
+    2800, 2800, 2800, 2800, 2801, 2842, 2843, 2844, 2845, 2846, 2847, 2848,
+    2849, 2850, 2851, 2852, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900,
+    2901, 2902, 2903, 2904, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952,
+    2953, 2954, 2955, 2996, 2840, 2840, 2840, 2840, 2841, 2882, 2883, 2884,
+    2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2933, 2934, 2935, 2936,
+    2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2985, 2986, 2987, 2988,
+    2989, 2990, 2991, 2992, 2993, 2994, 2995, 3036, 2880, 2880, 2880, 2880,
+    2881, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932,
+    2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984,
+    3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036,
+    2920, 2920, 2920, 2920, 2921, 2962, 2963, 2964, 2965, 2966, 2967, 2968,
+    2969, 2970, 2971, 2972, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020,
+    3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032,
+    3033, 3034, 3035, 3036,
+  },
+  {
+    80, 80, 80, 80, 81, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 120, 120, 120, 120, 121, 82, 83, 84,
+    85, 86, 87, 88, 89, 90, 91, 92, 53, 54, 55, 56,
+    57, 58, 59, 60, 61, 62, 63, 64, 25, 26, 27, 28,
+    29, 30, 31, 32, 33, 34, 35, 36, 160, 160, 160, 160,
+    161, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 36,
+    200, 200, 200, 200, 201, 162, 163, 164, 165, 166, 167, 168,
+    169, 170, 171, 172, 133, 134, 135, 136, 137, 138, 139, 140,
+    141, 142, 143, 144, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 76, 240, 240, 240, 240, 241, 202, 203, 204,
+    205, 206, 207, 208, 209, 210, 211, 212, 173, 174, 175, 176,
+    177, 178, 179, 180, 181, 182, 183, 184, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 116, 280, 280, 280, 280,
+    281, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+    185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 156,
+    320, 320, 320, 320, 321, 282, 283, 284, 285, 286, 287, 288,
+    289, 290, 291, 292, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 225, 226, 227, 228, 229, 230, 231, 232,
+    233, 234, 235, 196, 360, 360, 360, 360, 361, 322, 323, 324,
+    325, 326, 327, 328, 329, 330, 331, 332, 293, 294, 295, 296,
+    297, 298, 299, 300, 301, 302, 303, 304, 265, 266, 267, 268,
+    269, 270, 271, 272, 273, 274, 275, 236, 400, 400, 400, 400,
+    401, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+    333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+    305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 276,
+    440, 440, 440, 441, 442, 403, 404, 405, 406, 407, 408, 409,
+    410, 410, 411, 412, 373, 374, 375, 376, 377, 378, 379, 380,
+    381, 382, 383, 384, 345, 346, 347, 348, 349, 350, 351, 352,
+    353, 354, 355, 316, 480, 480, 480, 481, 482, 443, 444, 445,
+    446, 447, 448, 449, 450, 451, 452, 453, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 393, 394, 395, 356, 520, 520, 520, 521,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
+    454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 425,
+    426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 397,
+    560, 560, 560, 561, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 494, 495, 496, 497, 498, 499, 500, 501,
+    502, 503, 504, 465, 466, 467, 468, 469, 470, 471, 472, 473,
+    474, 475, 476, 437, 600, 600, 600, 601, 562, 563, 564, 565,
+    566, 567, 568, 569, 570, 571, 572, 573, 534, 535, 536, 537,
+    538, 539, 540, 541, 542, 543, 544, 505, 506, 507, 508, 509,
+    510, 511, 512, 513, 514, 515, 516, 477, 640, 640, 640, 641,
+    602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613,
+    574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 517,
+    680, 680, 680, 681, 642, 643, 644, 645, 646, 647, 648, 649,
+    650, 651, 652, 653, 614, 615, 616, 617, 618, 619, 620, 621,
+    622, 623, 624, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 557, 720, 720, 720, 721, 682, 683, 684, 685,
+    686, 687, 688, 689, 690, 691, 692, 693, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 625, 626, 627, 628, 629,
+    630, 631, 632, 633, 634, 635, 636, 597, 760, 760, 760, 761,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733,
+    694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 665,
+    666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 637,
+    800, 800, 800, 801, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 734, 735, 736, 737, 738, 739, 740, 741,
+    742, 743, 744, 705, 706, 707, 708, 709, 710, 711, 712, 713,
+    714, 715, 716, 677, 840, 840, 840, 841, 802, 803, 804, 805,
+    806, 807, 808, 809, 810, 811, 812, 813, 774, 775, 776, 777,
+    778, 779, 780, 781, 782, 783, 784, 745, 746, 747, 748, 749,
+    750, 751, 752, 753, 754, 755, 756, 717, 880, 880, 880, 881,
+    842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853,
+    814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 785,
+    786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 756, 757,
+    920, 920, 921, 922, 883, 884, 885, 886, 887, 888, 889, 890,
+    891, 892, 893, 894, 855, 856, 857, 858, 859, 860, 861, 862,
+    863, 863, 864, 825, 826, 827, 828, 829, 830, 831, 832, 833,
+    834, 835, 796, 797, 960, 960, 961, 962, 923, 924, 925, 926,
+    927, 928, 929, 930, 931, 932, 933, 894, 895, 896, 897, 898,
+    899, 900, 901, 902, 903, 904, 905, 866, 867, 868, 869, 870,
+    871, 872, 873, 874, 875, 876, 837, 838, 1000, 1000, 1001, 1002,
+    963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 934,
+    935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 906,
+    907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 877, 878,
+    1040, 1040, 1041, 1042, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
+    1011, 1012, 1013, 974, 975, 976, 977, 978, 979, 980, 981, 982,
+    983, 984, 985, 946, 947, 948, 949, 950, 951, 952, 953, 954,
+    955, 956, 917, 918, 1080, 1080, 1081, 1082, 1043, 1044, 1045, 1046,
+    1047, 1048, 1049, 1050, 1051, 1052, 1053, 1014, 1015, 1016, 1017, 1018,
+    1019, 1020, 1021, 1022, 1023, 1024, 1025, 986, 987, 988, 989, 990,
+    991, 992, 993, 994, 995, 996, 957, 958, 1120, 1120, 1121, 1122,
+    1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1054,
+    1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1026,
+    1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 997, 998,
+    1160, 1160, 1161, 1162, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130,
+    1131, 1132, 1133, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102,
+    1103, 1104, 1105, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
+    1075, 1076, 1037, 1038, 1200, 1200, 1201, 1202, 1163, 1164, 1165, 1166,
+    1167, 1168, 1169, 1170, 1171, 1172, 1173, 1134, 1135, 1136, 1137, 1138,
+    1139, 1140, 1141, 1142, 1143, 1144, 1145, 1106, 1107, 1108, 1109, 1110,
+    1111, 1112, 1113, 1114, 1115, 1116, 1077, 1078, 1240, 1240, 1241, 1242,
+    1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1174,
+    1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1146,
+    1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1117, 1118,
+    1280, 1280, 1281, 1282, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250,
+    1251, 1252, 1253, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222,
+    1223, 1224, 1225, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+    1195, 1196, 1157, 1158, 1320, 1320, 1321, 1322, 1283, 1284, 1285, 1286,
+    1287, 1288, 1289, 1290, 1291, 1292, 1293, 1254, 1255, 1256, 1257, 1258,
+    1259, 1260, 1261, 1262, 1263, 1264, 1265, 1226, 1227, 1228, 1229, 1230,
+    1231, 1232, 1233, 1234, 1235, 1236, 1197, 1198, 1360, 1361, 1362, 1363,
+    1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1333, 1294,
+    1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1265, 1266,
+    1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1237, 1238,
+    1400, 1401, 1402, 1403, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
+    1372, 1373, 1374, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+    1344, 1345, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315,
+    1316, 1316, 1277, 1278, 1440, 1441, 1442, 1403, 1404, 1405, 1406, 1407,
+    1408, 1409, 1410, 1411, 1412, 1413, 1414, 1375, 1376, 1377, 1378, 1379,
+    1380, 1381, 1382, 1383, 1384, 1385, 1346, 1347, 1348, 1349, 1350, 1351,
+    1352, 1353, 1354, 1355, 1356, 1357, 1318, 1319, 1480, 1481, 1482, 1443,
+    1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1415,
+    1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1386, 1387,
+    1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1358, 1359,
+    1520, 1521, 1522, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491,
+    1492, 1493, 1494, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463,
+    1464, 1465, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435,
+    1436, 1437, 1398, 1399, 1560, 1561, 1562, 1523, 1524, 1525, 1526, 1527,
+    1528, 1529, 1530, 1531, 1532, 1533, 1534, 1495, 1496, 1497, 1498, 1499,
+    1500, 1501, 1502, 1503, 1504, 1505, 1466, 1467, 1468, 1469, 1470, 1471,
+    1472, 1473, 1474, 1475, 1476, 1477, 1438, 1439, 1600, 1601, 1602, 1563,
+    1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1535,
+    1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1506, 1507,
+    1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1478, 1479,
+    1640, 1641, 1642, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611,
+    1612, 1613, 1614, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555,
+    1556, 1557, 1518, 1519, 1680, 1681, 1682, 1643, 1644, 1645, 1646, 1647,
+    1648, 1649, 1650, 1651, 1652, 1653, 1654, 1615, 1616, 1617, 1618, 1619,
+    1620, 1621, 1622, 1623, 1624, 1625, 1586, 1587, 1588, 1589, 1590, 1591,
+    1592, 1593, 1594, 1595, 1596, 1597, 1558, 1559, 1720, 1721, 1722, 1683,
+    1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1655,
+    1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1626, 1627,
+    1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1598, 1599,
+    1760, 1761, 1762, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731,
+    1732, 1733, 1734, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703,
+    1704, 1705, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675,
+    1676, 1677, 1638, 1639, 1801, 1802, 1803, 1764, 1764, 1765, 1766, 1767,
+    1768, 1769, 1770, 1771, 1772, 1773, 1774, 1735, 1736, 1737, 1738, 1739,
+    1740, 1741, 1742, 1743, 1744, 1745, 1706, 1707, 1708, 1709, 1710, 1711,
+    1712, 1713, 1714, 1715, 1716, 1677, 1678, 1679, 1841, 1842, 1843, 1804,
+    1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1776,
+    1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1747, 1747,
+    1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1717, 1718, 1719,
+    1881, 1882, 1883, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852,
+    1853, 1854, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
+    1825, 1826, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796,
+    1797, 1758, 1759, 1759, 1921, 1922, 1923, 1884, 1885, 1886, 1887, 1888,
+    1889, 1890, 1891, 1892, 1893, 1894, 1855, 1856, 1857, 1858, 1859, 1860,
+    1861, 1862, 1863, 1864, 1865, 1866, 1827, 1828, 1829, 1830, 1831, 1832,
+    1833, 1834, 1835, 1836, 1837, 1798, 1799, 1799, 1961, 1962, 1963, 1924,
+    1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1895, 1896,
+    1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1867, 1868,
+    1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1838, 1839, 1839,
+    2001, 2002, 2003, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972,
+    1973, 1974, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944,
+    1945, 1946, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916,
+    1917, 1878, 1879, 1879, 2041, 2042, 2043, 2004, 2005, 2006, 2007, 2008,
+    2009, 2010, 2011, 2012, 2013, 2014, 1975, 1976, 1977, 1978, 1979, 1980,
+    1981, 1982, 1983, 1984, 1985, 1986, 1947, 1948, 1949, 1950, 1951, 1952,
+    1953, 1954, 1955, 1956, 1957, 1918, 1919, 1919, 2081, 2082, 2083, 2044,
+    2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2015, 2016,
+    2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 1987, 1988,
+    1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1958, 1959, 1959,
+    2121, 2122, 2123, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092,
+    2093, 2094, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064,
+    2065, 2066, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036,
+    2037, 1998, 1999, 1999, 2161, 2162, 2163, 2124, 2125, 2126, 2127, 2128,
+    2129, 2130, 2131, 2132, 2133, 2134, 2095, 2096, 2097, 2098, 2099, 2100,
+    2101, 2102, 2103, 2104, 2105, 2106, 2067, 2068, 2069, 2070, 2071, 2072,
+    2073, 2074, 2075, 2076, 2077, 2038, 2039, 2039, 2201, 2202, 2203, 2164,
+    2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2135, 2136,
+    2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2107, 2108,
+    2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2078, 2079, 2079,
+    2241, 2242, 2243, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212,
+    2213, 2214, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184,
+    2185, 2186, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+    2157, 2118, 2119, 2119, 2282, 2283, 2284, 2245, 2246, 2247, 2248, 2249,
+    2250, 2251, 2252, 2253, 2254, 2255, 2216, 2217, 2217, 2218, 2219, 2220,
+    2221, 2222, 2223, 2224, 2225, 2186, 2187, 2188, 2189, 2190, 2191, 2192,
+    2193, 2194, 2195, 2196, 2197, 2158, 2159, 2159, 2322, 2323, 2324, 2285,
+    2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2256, 2257,
+    2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2227, 2228, 2229,
+    2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2199, 2199, 2199,
+    2362, 2363, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333,
+    2334, 2335, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305,
+    2306, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277,
+    2278, 2239, 2239, 2239, 2402, 2403, 2364, 2365, 2366, 2367, 2368, 2369,
+    2370, 2371, 2372, 2373, 2374, 2375, 2336, 2337, 2338, 2339, 2340, 2341,
+    2342, 2343, 2344, 2345, 2346, 2307, 2308, 2309, 2310, 2311, 2312, 2313,
+    2314, 2315, 2316, 2317, 2318, 2279, 2279, 2279, 2442, 2443, 2404, 2405,
+    2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2376, 2377,
+    2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2347, 2348, 2349,
+    2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2319, 2319, 2319,
+    2482, 2483, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453,
+    2454, 2455, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425,
+    2426, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397,
+    2398, 2359, 2359, 2359, 2522, 2523, 2484, 2485, 2486, 2487, 2488, 2489,
+    2490, 2491, 2492, 2493, 2494, 2495, 2456, 2457, 2458, 2459, 2460, 2461,
+    2462, 2463, 2464, 2465, 2466, 2427, 2428, 2429, 2430, 2431, 2432, 2433,
+    2434, 2435, 2436, 2437, 2438, 2399, 2399, 2399, 2562, 2563, 2524, 2525,
+    2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2496, 2497,
+    2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2467, 2468, 2469,
+    2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2439, 2439, 2439,
+    2602, 2603, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+    2574, 2575, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545,
+    2546, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517,
+    2518, 2479, 2479, 2479, 2642, 2643, 2604, 2605, 2606, 2607, 2608, 2609,
+    2610, 2611, 2612, 2613, 2614, 2615, 2576, 2577, 2578, 2579, 2580, 2581,
+    2582, 2583, 2584, 2585, 2586, 2547, 2548, 2549, 2550, 2551, 2552, 2553,
+    2554, 2555, 2556, 2557, 2558, 2519, 2519, 2519, 2682, 2683, 2644, 2645,
+    2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2616, 2617,
+    2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2587, 2588, 2589,
+    2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2559, 2559, 2559,
+    2723, 2724, 2685, 2686, 2687, 2687, 2688, 2689, 2690, 2691, 2692, 2693,
+    2694, 2695, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665,
+    2666, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637,
+    2598, 2599, 2599, 2599, 2763, 2764, 2725, 2726, 2727, 2728, 2729, 2730,
+    2731, 2732, 2733, 2734, 2735, 2696, 2697, 2698, 2699, 2700, 2701, 2702,
+    2703, 2704, 2705, 2706, 2707, 2668, 2669, 2670, 2670, 2671, 2672, 2673,
+    2674, 2675, 2676, 2677, 2638, 2639, 2639, 2639, 2803, 2804, 2765, 2766,
+    2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2736, 2737, 2738,
+    2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2708, 2709, 2710,
+    2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2679, 2679, 2679, 2679,
+    2843, 2844, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814,
+    2815, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786,
+    2787, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758,
+    2719, 2719, 2719, 2719, 2883, 2884, 2845, 2846, 2847, 2848, 2849, 2850,
+    2851, 2852, 2853, 2854, 2855, 2816, 2817, 2818, 2819, 2820, 2821, 2822,
+    2823, 2824, 2825, 2826, 2827, 2788, 2789, 2790, 2791, 2792, 2793, 2794,
+    2795, 2796, 2797, 2798, 2759, 2759, 2759, 2759, 2923, 2924, 2885, 2886,
+    2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2856, 2857, 2858,
+    2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2828, 2829, 2830,
+    2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2799, 2799, 2799, 2799,
+    2963, 2964, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934,
+    2935, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906,
+    2907, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878,
+    2839, 2839, 2839, 2839, 3003, 3004, 2965, 2966, 2967, 2968, 2969, 2970,
+    2971, 2972, 2973, 2974, 2975, 2936, 2937, 2938, 2939, 2940, 2941, 2942,
+    2943, 2944, 2945, 2946, 2947, 2908, 2909, 2910, 2911, 2912, 2913, 2914,
+    2915, 2916, 2917, 2918, 2879, 2879, 2879, 2879, 3003, 3004, 3005, 3006,
+    3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 2976, 2977, 2978,
+    2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2948, 2949, 2950,
+    2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2919, 2919, 2919, 2919,
+    3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014,
+    3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026,
+    3027, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998,
+    2959, 2959, 2959, 2959,
+  },
+  {
+    160, 160, 160, 160, 120, 120, 120, 121, 122, 83, 84, 85,
+    86, 87, 87, 48, 49, 50, 51, 52, 53, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+    29, 30, 31, 32, 200, 200, 200, 200, 160, 160, 160, 161,
+    162, 123, 124, 125, 126, 127, 128, 89, 90, 91, 92, 93,
+    94, 55, 56, 57, 58, 58, 59, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 240, 240, 240, 200,
+    200, 200, 200, 201, 202, 163, 164, 165, 166, 167, 168, 129,
+    130, 131, 132, 133, 134, 95, 96, 97, 98, 99, 100, 61,
+    62, 63, 64, 65, 26, 27, 28, 29, 30, 30, 31, 32,
+    280, 280, 280, 240, 240, 240, 240, 241, 242, 203, 204, 205,
+    206, 207, 208, 169, 170, 171, 172, 173, 174, 135, 136, 137,
+    138, 139, 100, 101, 102, 103, 104, 105, 66, 67, 68, 69,
+    70, 71, 32, 33, 320, 320, 320, 280, 280, 280, 280, 281,
+    282, 243, 244, 245, 246, 247, 248, 209, 210, 211, 212, 213,
+    214, 175, 176, 177, 178, 179, 140, 141, 142, 143, 144, 145,
+    106, 107, 108, 109, 110, 111, 72, 73, 360, 360, 360, 320,
+    320, 320, 320, 321, 322, 283, 284, 285, 286, 287, 288, 249,
+    250, 251, 252, 253, 254, 215, 216, 217, 218, 219, 180, 181,
+    182, 183, 184, 185, 146, 147, 148, 149, 150, 151, 112, 113,
+    400, 400, 400, 360, 360, 360, 361, 362, 363, 324, 325, 326,
+    327, 328, 329, 290, 291, 291, 292, 293, 254, 255, 256, 257,
+    258, 259, 220, 221, 222, 223, 224, 225, 186, 187, 188, 189,
+    190, 191, 152, 153, 440, 440, 440, 400, 400, 400, 401, 402,
+    403, 364, 365, 366, 367, 368, 369, 330, 331, 332, 333, 334,
+    295, 296, 297, 298, 299, 300, 261, 262, 262, 263, 264, 265,
+    226, 227, 228, 229, 230, 231, 192, 193, 480, 480, 480, 440,
+    440, 440, 441, 442, 443, 404, 405, 406, 407, 408, 369, 370,
+    371, 372, 373, 374, 335, 336, 337, 338, 339, 340, 301, 302,
+    303, 304, 305, 306, 267, 268, 269, 270, 271, 272, 233, 234,
+    520, 520, 520, 480, 480, 480, 481, 482, 483, 444, 445, 446,
+    447, 448, 409, 410, 411, 412, 413, 414, 375, 376, 377, 378,
+    379, 380, 341, 342, 343, 344, 345, 346, 307, 308, 309, 310,
+    311, 272, 273, 274, 560, 560, 560, 520, 520, 520, 521, 522,
+    523, 484, 485, 486, 487, 488, 449, 450, 451, 452, 453, 454,
+    415, 416, 417, 418, 419, 420, 381, 382, 383, 384, 385, 386,
+    347, 348, 349, 350, 351, 312, 313, 314, 600, 600, 600, 560,
+    560, 561, 562, 563, 523, 524, 525, 526, 527, 528, 489, 490,
+    491, 492, 493, 494, 455, 456, 457, 458, 459, 460, 421, 422,
+    423, 424, 425, 426, 387, 388, 389, 390, 391, 352, 353, 354,
+    640, 640, 640, 600, 600, 601, 602, 603, 564, 565, 566, 567,
+    568, 569, 530, 531, 532, 533, 534, 535, 495, 496, 497, 498,
+    499, 500, 461, 462, 463, 464, 465, 426, 427, 428, 429, 430,
+    431, 392, 393, 394, 680, 680, 680, 640, 640, 641, 642, 643,
+    604, 605, 606, 607, 608, 609, 570, 571, 572, 573, 574, 575,
+    536, 537, 538, 539, 540, 541, 502, 503, 504, 505, 506, 466,
+    467, 468, 469, 470, 471, 432, 433, 434, 720, 720, 680, 680,
+    680, 681, 682, 683, 644, 645, 646, 647, 648, 649, 610, 611,
+    612, 613, 614, 615, 576, 577, 578, 579, 580, 541, 542, 543,
+    544, 545, 546, 507, 508, 509, 510, 511, 512, 473, 474, 475,
+    760, 760, 720, 720, 720, 721, 722, 723, 684, 685, 686, 687,
+    688, 689, 650, 651, 652, 653, 654, 655, 616, 617, 618, 619,
+    620, 581, 582, 583, 584, 585, 586, 547, 548, 549, 550, 551,
+    552, 513, 514, 515, 800, 800, 760, 760, 760, 761, 762, 763,
+    724, 725, 726, 727, 728, 729, 690, 691, 692, 693, 694, 695,
+    656, 657, 658, 659, 660, 621, 622, 623, 624, 625, 626, 587,
+    588, 589, 590, 591, 592, 553, 554, 555, 840, 840, 800, 800,
+    801, 802, 803, 804, 765, 766, 767, 767, 768, 769, 730, 731,
+    732, 733, 734, 695, 696, 697, 698, 699, 700, 661, 662, 663,
+    664, 665, 666, 627, 628, 629, 630, 631, 632, 593, 594, 595,
+    880, 880, 840, 840, 841, 842, 843, 844, 805, 806, 807, 808,
+    809, 810, 771, 772, 773, 774, 775, 736, 737, 738, 738, 739,
+    740, 701, 702, 703, 704, 705, 706, 667, 668, 669, 670, 671,
+    672, 633, 634, 635, 920, 920, 880, 880, 881, 882, 883, 884,
+    845, 846, 847, 848, 849, 850, 811, 812, 813, 814, 815, 776,
+    777, 778, 779, 780, 781, 742, 743, 744, 745, 746, 747, 708,
+    709, 710, 710, 711, 712, 673, 674, 675, 960, 960, 920, 920,
+    921, 922, 923, 924, 885, 886, 887, 888, 889, 850, 851, 852,
+    853, 854, 855, 816, 817, 818, 819, 820, 821, 782, 783, 784,
+    785, 786, 787, 748, 749, 750, 751, 752, 713, 714, 715, 716,
+    1000, 1000, 960, 960, 961, 962, 963, 964, 925, 926, 927, 928,
+    929, 890, 891, 892, 893, 894, 895, 856, 857, 858, 859, 860,
+    861, 822, 823, 824, 825, 826, 827, 788, 789, 790, 791, 792,
+    753, 754, 755, 756, 1040, 1040, 1000, 1000, 1001, 1002, 1003, 1004,
+    965, 966, 967, 968, 969, 930, 931, 932, 933, 934, 935, 896,
+    897, 898, 899, 900, 901, 862, 863, 864, 865, 866, 867, 828,
+    829, 830, 831, 832, 793, 794, 795, 796, 1080, 1080, 1040, 1041,
+    1042, 1043, 1044, 1005, 1006, 1007, 1008, 1009, 1010, 971, 971, 972,
+    973, 974, 975, 936, 937, 938, 939, 940, 941, 902, 903, 904,
+    905, 906, 867, 868, 869, 870, 871, 872, 833, 834, 835, 836,
+    1120, 1120, 1080, 1081, 1082, 1083, 1084, 1045, 1046, 1047, 1048, 1049,
+    1050, 1011, 1012, 1013, 1014, 1015, 1016, 977, 978, 979, 980, 981,
+    982, 942, 943, 944, 945, 946, 907, 908, 909, 910, 911, 912,
+    873, 874, 875, 876, 1160, 1120, 1120, 1121, 1122, 1123, 1124, 1085,
+    1086, 1087, 1088, 1089, 1090, 1051, 1052, 1053, 1054, 1055, 1056, 1017,
+    1018, 1019, 1020, 1021, 1022, 983, 984, 985, 986, 987, 948, 949,
+    950, 951, 952, 953, 913, 914, 915, 916, 1200, 1160, 1160, 1161,
+    1162, 1163, 1164, 1125, 1126, 1127, 1128, 1129, 1130, 1091, 1092, 1093,
+    1094, 1095, 1096, 1057, 1058, 1059, 1060, 1061, 1022, 1023, 1024, 1025,
+    1026, 1027, 988, 989, 990, 991, 992, 993, 954, 955, 956, 957,
+    1240, 1200, 1200, 1201, 1202, 1203, 1204, 1165, 1166, 1167, 1168, 1169,
+    1170, 1131, 1132, 1133, 1134, 1135, 1136, 1097, 1098, 1099, 1100, 1101,
+    1062, 1063, 1064, 1065, 1066, 1067, 1028, 1029, 1030, 1031, 1032, 1033,
+    994, 995, 996, 997, 1280, 1240, 1241, 1242, 1243, 1243, 1244, 1205,
+    1206, 1207, 1208, 1209, 1210, 1171, 1172, 1173, 1174, 1175, 1136, 1137,
+    1138, 1139, 1140, 1141, 1102, 1103, 1104, 1105, 1106, 1107, 1068, 1069,
+    1070, 1071, 1072, 1073, 1034, 1035, 1036, 1037, 1320, 1280, 1281, 1282,
+    1283, 1284, 1285, 1246, 1247, 1248, 1249, 1250, 1251, 1212, 1213, 1214,
+    1214, 1215, 1176, 1177, 1178, 1179, 1180, 1181, 1142, 1143, 1144, 1145,
+    1146, 1147, 1108, 1109, 1110, 1111, 1112, 1113, 1074, 1075, 1076, 1077,
+    1360, 1320, 1321, 1322, 1323, 1324, 1325, 1286, 1287, 1288, 1289, 1290,
+    1291, 1252, 1253, 1254, 1255, 1256, 1217, 1218, 1219, 1220, 1221, 1222,
+    1183, 1184, 1185, 1186, 1186, 1187, 1148, 1149, 1150, 1151, 1152, 1153,
+    1114, 1115, 1116, 1117, 1400, 1360, 1361, 1362, 1363, 1364, 1365, 1326,
+    1327, 1328, 1329, 1330, 1291, 1292, 1293, 1294, 1295, 1296, 1257, 1258,
+    1259, 1260, 1261, 1262, 1223, 1224, 1225, 1226, 1227, 1228, 1189, 1190,
+    1191, 1192, 1193, 1194, 1155, 1156, 1157, 1157, 1440, 1400, 1401, 1402,
+    1403, 1404, 1405, 1366, 1367, 1368, 1369, 1370, 1331, 1332, 1333, 1334,
+    1335, 1336, 1297, 1298, 1299, 1300, 1301, 1302, 1263, 1264, 1265, 1266,
+    1267, 1268, 1229, 1230, 1231, 1232, 1233, 1194, 1195, 1196, 1197, 1198,
+    1480, 1440, 1441, 1442, 1443, 1444, 1445, 1406, 1407, 1408, 1409, 1410,
+    1371, 1372, 1373, 1374, 1375, 1376, 1337, 1338, 1339, 1340, 1341, 1342,
+    1303, 1304, 1305, 1306, 1307, 1308, 1269, 1270, 1271, 1272, 1273, 1234,
+    1235, 1236, 1237, 1238, 1520, 1481, 1482, 1483, 1484, 1485, 1446, 1447,
+    1447, 1448, 1449, 1450, 1411, 1412, 1413, 1414, 1415, 1416, 1377, 1378,
+    1379, 1380, 1381, 1382, 1343, 1344, 1345, 1346, 1347, 1308, 1309, 1310,
+    1311, 1312, 1313, 1274, 1275, 1276, 1277, 1278, 1560, 1521, 1522, 1523,
+    1524, 1525, 1486, 1487, 1488, 1489, 1490, 1491, 1452, 1453, 1454, 1455,
+    1456, 1457, 1418, 1418, 1419, 1420, 1421, 1422, 1383, 1384, 1385, 1386,
+    1387, 1348, 1349, 1350, 1351, 1352, 1353, 1314, 1315, 1316, 1317, 1318,
+    1600, 1561, 1562, 1563, 1564, 1565, 1526, 1527, 1528, 1529, 1530, 1531,
+    1492, 1493, 1494, 1495, 1496, 1497, 1458, 1459, 1460, 1461, 1462, 1463,
+    1424, 1425, 1426, 1427, 1428, 1389, 1390, 1390, 1391, 1392, 1393, 1354,
+    1355, 1356, 1357, 1358, 1600, 1601, 1602, 1603, 1604, 1605, 1566, 1567,
+    1568, 1569, 1570, 1571, 1532, 1533, 1534, 1535, 1536, 1537, 1498, 1499,
+    1500, 1501, 1502, 1463, 1464, 1465, 1466, 1467, 1468, 1429, 1430, 1431,
+    1432, 1433, 1434, 1395, 1396, 1397, 1398, 1399, 1640, 1641, 1642, 1643,
+    1644, 1645, 1606, 1607, 1608, 1609, 1610, 1611, 1572, 1573, 1574, 1575,
+    1576, 1577, 1538, 1539, 1540, 1541, 1542, 1503, 1504, 1505, 1506, 1507,
+    1508, 1469, 1470, 1471, 1472, 1473, 1474, 1435, 1436, 1437, 1438, 1439,
+    1680, 1681, 1682, 1683, 1684, 1685, 1646, 1647, 1648, 1649, 1650, 1651,
+    1612, 1613, 1614, 1615, 1616, 1617, 1578, 1579, 1580, 1581, 1582, 1543,
+    1544, 1545, 1546, 1547, 1548, 1509, 1510, 1511, 1512, 1513, 1514, 1475,
+    1476, 1477, 1478, 1479, 1721, 1722, 1723, 1724, 1725, 1726, 1687, 1688,
+    1689, 1690, 1690, 1691, 1652, 1653, 1654, 1655, 1656, 1617, 1618, 1619,
+    1620, 1621, 1622, 1583, 1584, 1585, 1586, 1587, 1588, 1549, 1550, 1551,
+    1552, 1553, 1554, 1515, 1516, 1517, 1518, 1519, 1761, 1762, 1763, 1764,
+    1765, 1766, 1727, 1728, 1729, 1730, 1731, 1732, 1693, 1694, 1695, 1696,
+    1697, 1658, 1659, 1660, 1661, 1662, 1662, 1623, 1624, 1625, 1626, 1627,
+    1628, 1589, 1590, 1591, 1592, 1593, 1594, 1555, 1556, 1557, 1558, 1559,
+    1801, 1802, 1803, 1804, 1805, 1806, 1767, 1768, 1769, 1770, 1771, 1772,
+    1733, 1734, 1735, 1736, 1737, 1698, 1699, 1700, 1701, 1702, 1703, 1664,
+    1665, 1666, 1667, 1668, 1669, 1630, 1631, 1632, 1633, 1633, 1634, 1595,
+    1596, 1597, 1598, 1599, 1841, 1842, 1843, 1844, 1845, 1846, 1807, 1808,
+    1809, 1810, 1811, 1772, 1773, 1774, 1775, 1776, 1777, 1738, 1739, 1740,
+    1741, 1742, 1743, 1704, 1705, 1706, 1707, 1708, 1709, 1670, 1671, 1672,
+    1673, 1674, 1635, 1636, 1637, 1638, 1639, 1639, 1881, 1882, 1883, 1884,
+    1885, 1886, 1847, 1848, 1849, 1850, 1851, 1812, 1813, 1814, 1815, 1816,
+    1817, 1778, 1779, 1780, 1781, 1782, 1783, 1744, 1745, 1746, 1747, 1748,
+    1749, 1710, 1711, 1712, 1713, 1714, 1675, 1676, 1677, 1678, 1679, 1679,
+    1922, 1923, 1923, 1924, 1925, 1886, 1887, 1888, 1889, 1890, 1891, 1852,
+    1853, 1854, 1855, 1856, 1857, 1818, 1819, 1820, 1821, 1822, 1823, 1784,
+    1785, 1786, 1787, 1788, 1789, 1750, 1751, 1752, 1753, 1754, 1715, 1716,
+    1717, 1718, 1719, 1719, 1962, 1963, 1964, 1965, 1966, 1927, 1928, 1929,
+    1930, 1931, 1932, 1893, 1894, 1894, 1895, 1896, 1897, 1858, 1859, 1860,
+    1861, 1862, 1863, 1824, 1825, 1826, 1827, 1828, 1789, 1790, 1791, 1792,
+    1793, 1794, 1755, 1756, 1757, 1758, 1759, 1759, 2002, 2003, 2004, 2005,
+    2006, 1967, 1968, 1969, 1970, 1971, 1972, 1933, 1934, 1935, 1936, 1937,
+    1938, 1899, 1900, 1901, 1902, 1903, 1904, 1865, 1866, 1866, 1867, 1868,
+    1829, 1830, 1831, 1832, 1833, 1834, 1795, 1796, 1797, 1798, 1799, 1799,
+    2042, 2043, 2044, 2045, 2046, 2007, 2008, 2009, 2010, 2011, 2012, 1973,
+    1974, 1975, 1976, 1977, 1978, 1939, 1940, 1941, 1942, 1943, 1944, 1905,
+    1906, 1907, 1908, 1909, 1870, 1871, 1872, 1873, 1874, 1875, 1836, 1837,
+    1837, 1838, 1839, 1839, 2082, 2083, 2084, 2085, 2086, 2047, 2048, 2049,
+    2050, 2051, 2052, 2013, 2014, 2015, 2016, 2017, 2018, 1979, 1980, 1981,
+    1982, 1983, 1944, 1945, 1946, 1947, 1948, 1949, 1910, 1911, 1912, 1913,
+    1914, 1915, 1876, 1877, 1878, 1879, 1879, 1879, 2122, 2123, 2124, 2125,
+    2126, 2087, 2088, 2089, 2090, 2091, 2092, 2053, 2054, 2055, 2056, 2057,
+    2058, 2019, 2020, 2021, 2022, 2023, 1984, 1985, 1986, 1987, 1988, 1989,
+    1950, 1951, 1952, 1953, 1954, 1955, 1916, 1917, 1918, 1919, 1919, 1919,
+    2163, 2164, 2165, 2166, 2167, 2127, 2128, 2129, 2130, 2131, 2132, 2093,
+    2094, 2095, 2096, 2097, 2058, 2059, 2060, 2061, 2062, 2063, 2024, 2025,
+    2026, 2027, 2028, 2029, 1990, 1991, 1992, 1993, 1994, 1995, 1956, 1957,
+    1958, 1959, 1959, 1959, 2203, 2204, 2205, 2206, 2207, 2168, 2169, 2170,
+    2171, 2172, 2173, 2134, 2135, 2136, 2137, 2138, 2098, 2099, 2100, 2101,
+    2102, 2103, 2064, 2065, 2066, 2067, 2068, 2069, 2030, 2031, 2032, 2033,
+    2034, 2035, 1996, 1997, 1998, 1999, 1999, 1959, 2243, 2244, 2245, 2246,
+    2247, 2208, 2209, 2210, 2211, 2212, 2213, 2174, 2175, 2176, 2177, 2178,
+    2139, 2140, 2141, 2142, 2143, 2144, 2105, 2106, 2107, 2108, 2109, 2109,
+    2070, 2071, 2072, 2073, 2074, 2075, 2036, 2037, 2038, 2039, 2039, 1999,
+    2283, 2284, 2285, 2286, 2287, 2248, 2249, 2250, 2251, 2252, 2213, 2214,
+    2215, 2216, 2217, 2218, 2179, 2180, 2181, 2182, 2183, 2184, 2145, 2146,
+    2147, 2148, 2149, 2150, 2111, 2112, 2113, 2114, 2115, 2076, 2077, 2078,
+    2079, 2079, 2079, 2039, 2323, 2324, 2325, 2326, 2327, 2288, 2289, 2290,
+    2291, 2292, 2253, 2254, 2255, 2256, 2257, 2258, 2219, 2220, 2221, 2222,
+    2223, 2224, 2185, 2186, 2187, 2188, 2189, 2190, 2151, 2152, 2153, 2154,
+    2155, 2116, 2117, 2118, 2119, 2119, 2119, 2079, 2363, 2364, 2365, 2366,
+    2367, 2328, 2329, 2330, 2331, 2332, 2293, 2294, 2295, 2296, 2297, 2298,
+    2259, 2260, 2261, 2262, 2263, 2264, 2225, 2226, 2227, 2228, 2229, 2230,
+    2191, 2192, 2193, 2194, 2195, 2156, 2157, 2158, 2159, 2159, 2159, 2119,
+    2404, 2405, 2406, 2407, 2368, 2369, 2370, 2370, 2371, 2372, 2333, 2334,
+    2335, 2336, 2337, 2338, 2299, 2300, 2301, 2302, 2303, 2304, 2265, 2266,
+    2267, 2268, 2269, 2230, 2231, 2232, 2233, 2234, 2235, 2196, 2197, 2198,
+    2199, 2199, 2199, 2159, 2444, 2445, 2446, 2447, 2408, 2409, 2410, 2411,
+    2412, 2413, 2374, 2375, 2376, 2377, 2378, 2379, 2340, 2341, 2342, 2342,
+    2343, 2344, 2305, 2306, 2307, 2308, 2309, 2270, 2271, 2272, 2273, 2274,
+    2275, 2236, 2237, 2238, 2239, 2239, 2239, 2199, 2484, 2485, 2486, 2487,
+    2448, 2449, 2450, 2451, 2452, 2453, 2414, 2415, 2416, 2417, 2418, 2419,
+    2380, 2381, 2382, 2383, 2384, 2385, 2346, 2347, 2348, 2349, 2350, 2311,
+    2312, 2313, 2313, 2314, 2315, 2276, 2277, 2278, 2279, 2279, 2279, 2239,
+    2524, 2525, 2526, 2527, 2488, 2489, 2490, 2491, 2492, 2493, 2454, 2455,
+    2456, 2457, 2458, 2459, 2420, 2421, 2422, 2423, 2424, 2385, 2386, 2387,
+    2388, 2389, 2390, 2351, 2352, 2353, 2354, 2355, 2356, 2317, 2318, 2319,
+    2319, 2319, 2319, 2279, 2564, 2565, 2566, 2567, 2528, 2529, 2530, 2531,
+    2532, 2533, 2494, 2495, 2496, 2497, 2498, 2499, 2460, 2461, 2462, 2463,
+    2464, 2425, 2426, 2427, 2428, 2429, 2430, 2391, 2392, 2393, 2394, 2395,
+    2396, 2357, 2358, 2359, 2359, 2359, 2359, 2319, 2604, 2605, 2606, 2607,
+    2568, 2569, 2570, 2571, 2572, 2573, 2534, 2535, 2536, 2537, 2538, 2539,
+    2500, 2501, 2502, 2503, 2504, 2465, 2466, 2467, 2468, 2469, 2470, 2431,
+    2432, 2433, 2434, 2435, 2436, 2397, 2398, 2399, 2399, 2399, 2399, 2359,
+    2645, 2646, 2647, 2648, 2609, 2610, 2611, 2612, 2613, 2614, 2574, 2575,
+    2576, 2577, 2578, 2539, 2540, 2541, 2542, 2543, 2544, 2505, 2506, 2507,
+    2508, 2509, 2510, 2471, 2472, 2473, 2474, 2475, 2476, 2437, 2438, 2439,
+    2439, 2439, 2399, 2399, 2685, 2686, 2687, 2688, 2649, 2650, 2651, 2652,
+    2653, 2654, 2615, 2616, 2617, 2618, 2619, 2580, 2581, 2582, 2583, 2584,
+    2585, 2545, 2546, 2547, 2548, 2549, 2550, 2511, 2512, 2513, 2514, 2515,
+    2516, 2477, 2478, 2479, 2479, 2479, 2439, 2439, 2725, 2726, 2727, 2728,
+    2689, 2690, 2691, 2692, 2693, 2654, 2655, 2656, 2657, 2658, 2659, 2620,
+    2621, 2622, 2623, 2624, 2625, 2586, 2587, 2588, 2589, 2590, 2591, 2552,
+    2553, 2554, 2555, 2556, 2557, 2517, 2518, 2519, 2519, 2519, 2479, 2479,
+    2765, 2766, 2767, 2768, 2729, 2730, 2731, 2732, 2733, 2694, 2695, 2696,
+    2697, 2698, 2699, 2660, 2661, 2662, 2663, 2664, 2665, 2626, 2627, 2628,
+    2629, 2630, 2631, 2592, 2593, 2594, 2595, 2596, 2557, 2558, 2559, 2559,
+    2559, 2559, 2519, 2519, 2805, 2806, 2807, 2808, 2769, 2770, 2771, 2772,
+    2773, 2734, 2735, 2736, 2737, 2738, 2739, 2700, 2701, 2702, 2703, 2704,
+    2705, 2666, 2667, 2668, 2669, 2670, 2671, 2632, 2633, 2634, 2635, 2636,
+    2597, 2598, 2599, 2599, 2599, 2599, 2559, 2559, 2846, 2846, 2847, 2808,
+    2809, 2810, 2811, 2812, 2813, 2774, 2775, 2776, 2777, 2778, 2779, 2740,
+    2741, 2742, 2743, 2744, 2745, 2706, 2707, 2708, 2709, 2710, 2711, 2672,
+    2673, 2674, 2675, 2676, 2637, 2638, 2639, 2639, 2639, 2639, 2599, 2599,
+    2886, 2887, 2888, 2849, 2850, 2851, 2852, 2853, 2854, 2815, 2816, 2817,
+    2818, 2818, 2819, 2780, 2781, 2782, 2783, 2784, 2785, 2746, 2747, 2748,
+    2749, 2750, 2711, 2712, 2713, 2714, 2715, 2716, 2677, 2678, 2679, 2679,
+    2679, 2679, 2639, 2639, 2926, 2927, 2928, 2889, 2890, 2891, 2892, 2893,
+    2894, 2855, 2856, 2857, 2858, 2859, 2860, 2821, 2822, 2823, 2824, 2825,
+    2826, 2787, 2788, 2789, 2789, 2790, 2751, 2752, 2753, 2754, 2755, 2756,
+    2717, 2718, 2719, 2719, 2719, 2719, 2679, 2679, 2966, 2967, 2968, 2929,
+    2930, 2931, 2932, 2933, 2934, 2895, 2896, 2897, 2898, 2899, 2900, 2861,
+    2862, 2863, 2864, 2865, 2826, 2827, 2828, 2829, 2830, 2831, 2792, 2793,
+    2794, 2795, 2796, 2797, 2758, 2759, 2759, 2759, 2759, 2759, 2719, 2719,
+    3006, 3007, 3008, 2969, 2970, 2971, 2972, 2973, 2974, 2935, 2936, 2937,
+    2938, 2939, 2940, 2901, 2902, 2903, 2904, 2905, 2866, 2867, 2868, 2869,
+    2870, 2871, 2832, 2833, 2834, 2835, 2836, 2837, 2798, 2799, 2799, 2799,
+    2799, 2799, 2759, 2759, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013,
+    3014, 2975, 2976, 2977, 2978, 2979, 2980, 2941, 2942, 2943, 2944, 2945,
+    2906, 2907, 2908, 2909, 2910, 2911, 2872, 2873, 2874, 2875, 2876, 2877,
+    2838, 2839, 2839, 2839, 2839, 2839, 2799, 2799, 3007, 3008, 3009, 3010,
+    3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 2980, 2981,
+    2982, 2983, 2984, 2985, 2946, 2947, 2948, 2949, 2950, 2951, 2912, 2913,
+    2914, 2915, 2916, 2917, 2878, 2879, 2879, 2879, 2879, 2879, 2839, 2839,
+    3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018,
+    3019, 3020, 3021, 3022, 3022, 3023, 3024, 3025, 2986, 2987, 2988, 2989,
+    2990, 2991, 2952, 2953, 2954, 2955, 2956, 2957, 2918, 2919, 2919, 2919,
+    2919, 2879, 2879, 2879,
+  },
+  {
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 39, 39, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+    62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75, 76, 77, 78, 79, 79, 79, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+    110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 119, 119,
+    122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+    134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+    158, 159, 159, 159, 162, 163, 164, 165, 166, 167, 168, 169,
+    170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+    182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 199, 199, 202, 203, 204, 205,
+    206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+    218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229,
+    230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 239, 239,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265,
+    266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277,
+    278, 279, 279, 279, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313,
+    314, 315, 316, 317, 318, 319, 319, 319, 322, 323, 324, 325,
+    326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+    350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 359, 359,
+    362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397,
+    398, 399, 399, 399, 402, 403, 404, 405, 406, 407, 408, 409,
+    410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    434, 435, 436, 437, 438, 439, 439, 439, 442, 443, 444, 445,
+    446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457,
+    458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+    470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 479, 479,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
+    494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+    506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517,
+    518, 519, 519, 519, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541,
+    542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553,
+    554, 555, 556, 557, 558, 559, 559, 559, 562, 563, 564, 565,
+    566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589,
+    590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 599, 599,
+    602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613,
+    614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637,
+    638, 639, 639, 639, 642, 643, 644, 645, 646, 647, 648, 649,
+    650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661,
+    662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 679, 679, 682, 683, 684, 685,
+    686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697,
+    698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709,
+    710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 719, 719,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733,
+    734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745,
+    746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757,
+    758, 759, 759, 759, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781,
+    782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793,
+    794, 795, 796, 797, 798, 799, 799, 799, 802, 803, 804, 805,
+    806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817,
+    818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 839, 839,
+    842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853,
+    854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865,
+    866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877,
+    878, 879, 879, 879, 882, 883, 884, 885, 886, 887, 888, 889,
+    890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901,
+    902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913,
+    914, 915, 916, 917, 918, 919, 919, 919, 922, 923, 924, 925,
+    926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937,
+    938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949,
+    950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 959, 959,
+    962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973,
+    974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985,
+    986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997,
+    998, 999, 999, 999, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
+    1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021,
+    1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+    1034, 1035, 1036, 1037, 1038, 1039, 1039, 1039, 1042, 1043, 1044, 1045,
+    1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
+    1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+    1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1079, 1079,
+    1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+    1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+    1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
+    1118, 1119, 1119, 1119, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129,
+    1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
+    1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
+    1154, 1155, 1156, 1157, 1158, 1159, 1159, 1159, 1162, 1163, 1164, 1165,
+    1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177,
+    1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189,
+    1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1199, 1199,
+    1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+    1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
+    1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
+    1238, 1239, 1239, 1239, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249,
+    1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261,
+    1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273,
+    1274, 1275, 1276, 1277, 1278, 1279, 1279, 1279, 1282, 1283, 1284, 1285,
+    1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
+    1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+    1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1319, 1319,
+    1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+    1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345,
+    1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357,
+    1358, 1359, 1359, 1359, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369,
+    1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381,
+    1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+    1394, 1395, 1396, 1397, 1398, 1399, 1399, 1399, 1402, 1403, 1404, 1405,
+    1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
+    1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429,
+    1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1439, 1439,
+    1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453,
+    1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465,
+    1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+    1478, 1479, 1479, 1479, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489,
+    1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+    1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513,
+    1514, 1515, 1516, 1517, 1518, 1519, 1519, 1519, 1522, 1523, 1524, 1525,
+    1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537,
+    1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549,
+    1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1559, 1559,
+    1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
+    1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
+    1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597,
+    1598, 1599, 1599, 1599, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609,
+    1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621,
+    1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633,
+    1634, 1635, 1636, 1637, 1638, 1639, 1639, 1639, 1642, 1643, 1644, 1645,
+    1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
+    1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669,
+    1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1679, 1679,
+    1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693,
+    1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705,
+    1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,
+    1718, 1719, 1719, 1719, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729,
+    1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741,
+    1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+    1754, 1755, 1756, 1757, 1758, 1759, 1759, 1759, 1762, 1763, 1764, 1765,
+    1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777,
+    1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789,
+    1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1799, 1799,
+    1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813,
+    1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+    1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837,
+    1838, 1839, 1839, 1839, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849,
+    1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861,
+    1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873,
+    1874, 1875, 1876, 1877, 1878, 1879, 1879, 1879, 1882, 1883, 1884, 1885,
+    1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+    1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909,
+    1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1919, 1919,
+    1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933,
+    1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
+    1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957,
+    1958, 1959, 1959, 1959, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969,
+    1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981,
+    1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993,
+    1994, 1995, 1996, 1997, 1998, 1999, 1999, 1999, 2002, 2003, 2004, 2005,
+    2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017,
+    2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029,
+    2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2039, 2039,
+    2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053,
+    2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065,
+    2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077,
+    2078, 2079, 2079, 2079, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089,
+    2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101,
+    2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113,
+    2114, 2115, 2116, 2117, 2118, 2119, 2119, 2119, 2122, 2123, 2124, 2125,
+    2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137,
+    2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149,
+    2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2159, 2159,
+    2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173,
+    2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185,
+    2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197,
+    2198, 2199, 2199, 2199, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209,
+    2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221,
+    2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233,
+    2234, 2235, 2236, 2237, 2238, 2239, 2239, 2239, 2242, 2243, 2244, 2245,
+    2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257,
+    2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269,
+    2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2279, 2279,
+    2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293,
+    2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305,
+    2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317,
+    2318, 2319, 2319, 2319, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329,
+    2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341,
+    2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353,
+    2354, 2355, 2356, 2357, 2358, 2359, 2359, 2359, 2362, 2363, 2364, 2365,
+    2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377,
+    2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389,
+    2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2399, 2399,
+    2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+    2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425,
+    2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437,
+    2438, 2439, 2439, 2439, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449,
+    2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461,
+    2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473,
+    2474, 2475, 2476, 2477, 2478, 2479, 2479, 2479, 2482, 2483, 2484, 2485,
+    2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497,
+    2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509,
+    2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2519, 2519,
+    2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533,
+    2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545,
+    2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557,
+    2558, 2559, 2559, 2559, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569,
+    2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581,
+    2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593,
+    2594, 2595, 2596, 2597, 2598, 2599, 2599, 2599, 2602, 2603, 2604, 2605,
+    2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617,
+    2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629,
+    2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2639, 2639,
+    2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653,
+    2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665,
+    2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677,
+    2678, 2679, 2679, 2679, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689,
+    2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701,
+    2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713,
+    2714, 2715, 2716, 2717, 2718, 2719, 2719, 2719, 2722, 2723, 2724, 2725,
+    2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737,
+    2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749,
+    2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2759, 2759,
+    2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773,
+    2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785,
+    2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797,
+    2798, 2799, 2799, 2799, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809,
+    2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821,
+    2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833,
+    2834, 2835, 2836, 2837, 2838, 2839, 2839, 2839, 2842, 2843, 2844, 2845,
+    2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857,
+    2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869,
+    2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2879, 2879,
+    2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893,
+    2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905,
+    2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917,
+    2918, 2919, 2919, 2919, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929,
+    2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941,
+    2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953,
+    2954, 2955, 2956, 2957, 2958, 2959, 2959, 2959, 2962, 2963, 2964, 2965,
+    2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977,
+    2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989,
+    2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 2999, 2999,
+    3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013,
+    3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025,
+    3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037,
+    3038, 3039, 3039, 3039,
+  },
+  {
+    0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 40, 40, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 80, 80, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93,
+    94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+    106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    120, 120, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+    142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+    154, 155, 156, 157, 160, 160, 160, 161, 162, 163, 164, 165,
+    166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 191, 192, 193, 194, 195, 196, 197, 200, 200, 200, 201,
+    202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213,
+    214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237,
+    240, 240, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+    250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261,
+    262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 280, 280, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297,
+    298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309,
+    310, 311, 312, 313, 314, 315, 316, 317, 320, 320, 320, 321,
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333,
+    334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345,
+    346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357,
+    360, 360, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381,
+    382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393,
+    394, 395, 396, 397, 400, 400, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
+    430, 431, 432, 433, 434, 435, 436, 437, 440, 440, 440, 441,
+    442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477,
+    480, 480, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+    490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+    502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 520, 520, 520, 521, 522, 523, 524, 525,
+    526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
+    538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+    550, 551, 552, 553, 554, 555, 556, 557, 560, 560, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573,
+    574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585,
+    586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597,
+    600, 600, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621,
+    622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633,
+    634, 635, 636, 637, 640, 640, 640, 641, 642, 643, 644, 645,
+    646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669,
+    670, 671, 672, 673, 674, 675, 676, 677, 680, 680, 680, 681,
+    682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693,
+    694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717,
+    720, 720, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729,
+    730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741,
+    742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 760, 760, 760, 761, 762, 763, 764, 765,
+    766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777,
+    778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789,
+    790, 791, 792, 793, 794, 795, 796, 797, 800, 800, 800, 801,
+    802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813,
+    814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825,
+    826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837,
+    840, 840, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849,
+    850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
+    862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873,
+    874, 875, 876, 877, 880, 880, 880, 881, 882, 883, 884, 885,
+    886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897,
+    898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909,
+    910, 911, 912, 913, 914, 915, 916, 917, 920, 920, 920, 921,
+    922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933,
+    934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945,
+    946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957,
+    960, 960, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969,
+    970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981,
+    982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993,
+    994, 995, 996, 997, 1000, 1000, 1000, 1001, 1002, 1003, 1004, 1005,
+    1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+    1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
+    1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1040, 1040, 1040, 1041,
+    1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+    1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065,
+    1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+    1080, 1080, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089,
+    1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+    1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
+    1114, 1115, 1116, 1117, 1120, 1120, 1120, 1121, 1122, 1123, 1124, 1125,
+    1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137,
+    1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+    1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1160, 1160, 1160, 1161,
+    1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
+    1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+    1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197,
+    1200, 1200, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209,
+    1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
+    1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+    1234, 1235, 1236, 1237, 1240, 1240, 1240, 1241, 1242, 1243, 1244, 1245,
+    1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
+    1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269,
+    1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1280, 1280, 1280, 1281,
+    1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293,
+    1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,
+    1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
+    1320, 1320, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329,
+    1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341,
+    1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
+    1354, 1355, 1356, 1357, 1360, 1360, 1360, 1361, 1362, 1363, 1364, 1365,
+    1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377,
+    1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+    1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1400, 1400, 1400, 1401,
+    1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
+    1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425,
+    1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
+    1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449,
+    1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461,
+    1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473,
+    1474, 1475, 1476, 1477, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,
+    1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
+    1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509,
+    1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1520, 1520, 1520, 1521,
+    1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533,
+    1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545,
+    1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557,
+    1560, 1560, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569,
+    1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581,
+    1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593,
+    1594, 1595, 1596, 1597, 1600, 1600, 1600, 1601, 1602, 1603, 1604, 1605,
+    1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617,
+    1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629,
+    1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1640, 1640, 1640, 1641,
+    1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653,
+    1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665,
+    1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
+    1680, 1680, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689,
+    1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701,
+    1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713,
+    1714, 1715, 1716, 1717, 1720, 1720, 1720, 1721, 1722, 1723, 1724, 1725,
+    1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+    1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749,
+    1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1760, 1760, 1760, 1761,
+    1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+    1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
+    1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+    1800, 1800, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809,
+    1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821,
+    1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833,
+    1834, 1835, 1836, 1837, 1840, 1840, 1840, 1841, 1842, 1843, 1844, 1845,
+    1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857,
+    1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869,
+    1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1880, 1880, 1880, 1881,
+    1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
+    1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905,
+    1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917,
+    1920, 1920, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+    1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941,
+    1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953,
+    1954, 1955, 1956, 1957, 1960, 1960, 1960, 1961, 1962, 1963, 1964, 1965,
+    1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+    1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989,
+    1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 2000, 2000, 2000, 2001,
+    2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+    2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
+    2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037,
+    2040, 2040, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049,
+    2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061,
+    2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073,
+    2074, 2075, 2076, 2077, 2080, 2080, 2080, 2081, 2082, 2083, 2084, 2085,
+    2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097,
+    2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109,
+    2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2120, 2120, 2120, 2121,
+    2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133,
+    2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145,
+    2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157,
+    2160, 2160, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169,
+    2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181,
+    2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193,
+    2194, 2195, 2196, 2197, 2200, 2200, 2200, 2201, 2202, 2203, 2204, 2205,
+    2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217,
+    2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229,
+    2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2240, 2240, 2240, 2241,
+    2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253,
+    2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265,
+    2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277,
+    2280, 2280, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289,
+    2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301,
+    2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313,
+    2314, 2315, 2316, 2317, 2320, 2320, 2320, 2321, 2322, 2323, 2324, 2325,
+    2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337,
+    2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349,
+    2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2360, 2360, 2360, 2361,
+    2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373,
+    2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385,
+    2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397,
+    2400, 2400, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409,
+    2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421,
+    2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433,
+    2434, 2435, 2436, 2437, 2440, 2440, 2440, 2441, 2442, 2443, 2444, 2445,
+    2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+    2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469,
+    2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2480, 2480, 2480, 2481,
+    2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493,
+    2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505,
+    2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517,
+    2520, 2520, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529,
+    2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541,
+    2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553,
+    2554, 2555, 2556, 2557, 2560, 2560, 2560, 2561, 2562, 2563, 2564, 2565,
+    2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577,
+    2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589,
+    2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2600, 2600, 2600, 2601,
+    2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613,
+    2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625,
+    2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637,
+    2640, 2640, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649,
+    2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661,
+    2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673,
+    2674, 2675, 2676, 2677, 2680, 2680, 2680, 2681, 2682, 2683, 2684, 2685,
+    2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697,
+    2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709,
+    2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2720, 2720, 2720, 2721,
+    2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733,
+    2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745,
+    2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757,
+    2760, 2760, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769,
+    2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781,
+    2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793,
+    2794, 2795, 2796, 2797, 2800, 2800, 2800, 2801, 2802, 2803, 2804, 2805,
+    2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817,
+    2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829,
+    2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2840, 2840, 2840, 2841,
+    2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853,
+    2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865,
+    2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877,
+    2880, 2880, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889,
+    2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901,
+    2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913,
+    2914, 2915, 2916, 2917, 2920, 2920, 2920, 2921, 2922, 2923, 2924, 2925,
+    2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937,
+    2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949,
+    2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2960, 2960, 2960, 2961,
+    2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973,
+    2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985,
+    2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997,
+    3000, 3000, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009,
+    3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021,
+    3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033,
+    3034, 3035, 3036, 3037,
+  },
+  {
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+    92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+    140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+    164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+    188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+    212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+    236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259,
+    260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+    296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+    308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+    332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
+    344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+    356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+    380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
+    392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403,
+    404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+    416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+    428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+    440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
+    452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+    464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+    476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
+    488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+    524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+    536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571,
+    572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583,
+    584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595,
+    596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619,
+    620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631,
+    632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643,
+    644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667,
+    668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679,
+    680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691,
+    692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+    704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715,
+    716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+    728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739,
+    740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751,
+    752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763,
+    764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775,
+    776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787,
+    788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799,
+    800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811,
+    812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823,
+    824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835,
+    836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847,
+    848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859,
+    860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871,
+    872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883,
+    884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+    896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907,
+    908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919,
+    920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931,
+    932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+    944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955,
+    956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967,
+    968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979,
+    980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+    992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003,
+    1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
+    1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
+    1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
+    1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+    1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
+    1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
+    1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
+    1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
+    1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+    1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147,
+    1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159,
+    1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171,
+    1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+    1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+    1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+    1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219,
+    1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+    1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
+    1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
+    1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+    1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+    1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
+    1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303,
+    1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315,
+    1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+    1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+    1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351,
+    1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+    1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+    1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+    1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399,
+    1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
+    1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
+    1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435,
+    1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447,
+    1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459,
+    1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
+    1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483,
+    1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
+    1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
+    1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+    1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
+    1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543,
+    1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555,
+    1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
+    1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579,
+    1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591,
+    1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603,
+    1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+    1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627,
+    1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639,
+    1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651,
+    1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+    1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675,
+    1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687,
+    1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699,
+    1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
+    1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723,
+    1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735,
+    1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747,
+    1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759,
+    1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771,
+    1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783,
+    1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795,
+    1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+    1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819,
+    1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831,
+    1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843,
+    1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855,
+    1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867,
+    1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879,
+    1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891,
+    1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+    1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915,
+    1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927,
+    1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939,
+    1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+    1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963,
+    1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975,
+    1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987,
+    1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
+    2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011,
+    2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023,
+    2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035,
+    2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
+    2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059,
+    2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071,
+    2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
+    2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095,
+    2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107,
+    2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119,
+    2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131,
+    2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143,
+    2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155,
+    2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167,
+    2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179,
+    2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191,
+    2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203,
+    2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215,
+    2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227,
+    2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239,
+    2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251,
+    2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263,
+    2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275,
+    2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287,
+    2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299,
+    2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311,
+    2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323,
+    2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335,
+    2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347,
+    2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359,
+    2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371,
+    2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383,
+    2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395,
+    2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407,
+    2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419,
+    2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431,
+    2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443,
+    2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455,
+    2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467,
+    2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479,
+    2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491,
+    2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503,
+    2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515,
+    2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527,
+    2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539,
+    2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551,
+    2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563,
+    2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575,
+    2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587,
+    2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599,
+    2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611,
+    2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+    2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635,
+    2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647,
+    2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659,
+    2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+    2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683,
+    2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695,
+    2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707,
+    2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719,
+    2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731,
+    2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743,
+    2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755,
+    2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767,
+    2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779,
+    2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791,
+    2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803,
+    2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815,
+    2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827,
+    2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839,
+    2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851,
+    2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863,
+    2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875,
+    2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887,
+    2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899,
+    2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911,
+    2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923,
+    2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935,
+    2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947,
+    2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959,
+    2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971,
+    2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983,
+    2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995,
+    2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007,
+    3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019,
+    3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031,
+    3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3000, 3001, 3002, 3003,
+    3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015,
+    3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027,
+    3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039,
+    3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011,
+    3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023,
+    3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035,
+    3036, 3037, 3038, 3039,
+  },
+  {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
+    124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+    148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171,
+    172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+    196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
+    220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243,
+    244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291,
+    292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+    316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327,
+    328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339,
+    340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+    364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
+    376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387,
+    388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
+    412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
+    424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+    436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+    448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+    460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471,
+    472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+    496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+    508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+    520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+    544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555,
+    556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567,
+    568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603,
+    604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615,
+    616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627,
+    628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651,
+    652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663,
+    664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675,
+    676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699,
+    700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+    712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723,
+    724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
+    736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747,
+    748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759,
+    760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771,
+    772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783,
+    784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795,
+    796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807,
+    808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819,
+    820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+    832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843,
+    844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855,
+    856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867,
+    868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879,
+    880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891,
+    892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903,
+    904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915,
+    916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939,
+    940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951,
+    952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963,
+    964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975,
+    976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987,
+    988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999,
+    1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011,
+    1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+    1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
+    1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+    1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
+    1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
+    1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+    1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+    1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+    1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131,
+    1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
+    1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155,
+    1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+    1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179,
+    1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
+    1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
+    1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+    1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227,
+    1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
+    1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251,
+    1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+    1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
+    1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
+    1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
+    1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+    1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323,
+    1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335,
+    1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347,
+    1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+    1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
+    1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
+    1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395,
+    1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+    1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+    1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431,
+    1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443,
+    1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+    1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467,
+    1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479,
+    1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491,
+    1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+    1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515,
+    1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527,
+    1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539,
+    1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
+    1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563,
+    1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
+    1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+    1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599,
+    1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611,
+    1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623,
+    1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635,
+    1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647,
+    1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659,
+    1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
+    1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683,
+    1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+    1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707,
+    1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719,
+    1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731,
+    1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+    1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755,
+    1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767,
+    1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779,
+    1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803,
+    1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815,
+    1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827,
+    1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839,
+    1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851,
+    1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+    1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875,
+    1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+    1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899,
+    1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911,
+    1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923,
+    1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+    1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947,
+    1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
+    1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971,
+    1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+    1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995,
+    1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,
+    2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+    2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031,
+    2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043,
+    2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055,
+    2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067,
+    2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+    2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091,
+    2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103,
+    2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115,
+    2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+    2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139,
+    2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151,
+    2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163,
+    2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+    2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187,
+    2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199,
+    2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211,
+    2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223,
+    2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235,
+    2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247,
+    2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259,
+    2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
+    2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283,
+    2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295,
+    2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307,
+    2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319,
+    2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331,
+    2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343,
+    2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355,
+    2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367,
+    2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379,
+    2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391,
+    2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403,
+    2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+    2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427,
+    2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439,
+    2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451,
+    2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463,
+    2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475,
+    2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487,
+    2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499,
+    2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511,
+    2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523,
+    2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535,
+    2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547,
+    2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559,
+    2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571,
+    2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583,
+    2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595,
+    2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607,
+    2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619,
+    2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631,
+    2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643,
+    2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655,
+    2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667,
+    2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679,
+    2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691,
+    2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703,
+    2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715,
+    2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727,
+    2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739,
+    2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751,
+    2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763,
+    2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775,
+    2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787,
+    2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799,
+    2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811,
+    2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823,
+    2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835,
+    2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847,
+    2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859,
+    2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871,
+    2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883,
+    2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895,
+    2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907,
+    2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919,
+    2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931,
+    2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943,
+    2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955,
+    2956, 2957, 2958, 2959,
+  },
+};
+
+#endif /* FOCALTECH_NN_TABLES_H */
@@ -0,0 +1,253 @@
+/*
+ * FocalTech FT9362 NN inference benchmark
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * Times every layer of the embedding network with each convolution
+ * implementation and each kernel set supported by this CPU, and checks the
+ * embeddings, Winograd's included, against the scalar reference path. The
+ * TTA shifts are timed with and without reuse of the unshifted conv1.
+ *
+ * Build (needs the generated focaltech_nn_weights.h next to the sources, or
+ * a model file from focaltech_nn_export):
+ *   cc -O2 -Ishared tools/focaltech_nn_bench.c shared/focaltech_nn_kernels.c \
+ *      -lm -lpthread -o ft-nn-bench
+ *
+ * Usage:
+ *   ft-nn-bench [model.ftnn]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <time.h>
+
+/* Pull in the static layer kernels */
+#include "focaltech_nn_infer.c"
+
+#define BENCH_ITERS 200
+#define BENCH_LAYERS 6
+#define BENCH_BATCH 11  /* one TTA probe set */
+
+static const char *layer_names[BENCH_LAYERS] = {
+    "conv1", "conv2", "conv3", "conv4", "fc1", "fc2",
+};
+
+/* Compared per layer; ConvLayer.winograd records the winner for FT_NN_CONV_AUTO */
+static const FtNNConvAlgo algos[2] = { FT_NN_CONV_GEMM, FT_NN_CONV_WINOGRAD };
+static const char *algo_names[2] = { "gemm", "winograd" };
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/* Synthetic ridge pattern in [0, 1] */
+static void make_probe(float *image)
+{
+    for (int y = 0; y < FT_NN_INPUT_HEIGHT; y++) {
+        for (int x = 0; x < FT_NN_INPUT_WIDTH; x++) {
+            float v = 0.5f + 0.45f * sinf(0.7f * x + 0.35f * y + 0.2f * sinf(0.1f * y));
+            image[y * FT_NN_INPUT_WIDTH + x] = v;
+        }
+    }
+}
+
+/* Average time of every layer, feeding each the previous layer's output */
+static void bench_layers(FtNNWorkspace *ws, const float *input, double *layer_us)
+{
+    static float act[5][CONV1_OUT_CH * CONV1_OUT_H * CONV1_OUT_W];
+    static float fc1_out[FC1_OUT], fc2_out[FC2_OUT];
+    double start;
+
+    for (int l = 0; l < 4; l++) {
+        const float *in = l == 0 ? input : act[l];
+
+        start = now_us();
+        for (int it = 0; it < BENCH_ITERS; it++) {
+            conv_layer_forward(ws, l, in, 1, act[l + 1]);
+        }
+        layer_us[l] = (now_us() - start) / BENCH_ITERS;
+    }
+
+    start = now_us();
+    for (int it = 0; it < BENCH_ITERS; it++) {
+        fc_forward(ws, 0, act[4], 1, fc1_out);
+    }
+    layer_us[4] = (now_us() - start) / BENCH_ITERS;
+
+    start = now_us();
+    for (int it = 0; it < BENCH_ITERS; it++) {
+        fc_forward(ws, 1, fc1_out, 1, fc2_out);
+    }
+    layer_us[5] = (now_us() - start) / BENCH_ITERS;
+}
+
+static float max_abs_diff(const float *a, const float *b, int n)
+{
+    float max_diff = 0.0f;
+    for (int i = 0; i < n; i++) {
+        float d = fabsf(a[i] - b[i]);
+        if (d > max_diff) max_diff = d;
+    }
+    return max_diff;
+}
+
+/* Per-image time of BENCH_BATCH images, one by one and batched */
+static void bench_batch(FtNNWorkspace *ws, const float *input)
+{
+    static float inputs[BENCH_BATCH * FT_NN_INPUT_SIZE];
+    static float single[BENCH_BATCH * FT_NN_EMBEDDING_DIM];
+    static float batched[BENCH_BATCH * FT_NN_EMBEDDING_DIM];
+    double start, single_us, batch_us;
+    float diff = 0.0f;
+
+    for (int b = 0; b < BENCH_BATCH; b++) {
+        for (int i = 0; i < FT_NN_INPUT_SIZE; i++) {
+            float v = input[i] + 0.01f * b;
+            inputs[b * FT_NN_INPUT_SIZE + i] = v > 1.0f ? 1.0f : v;
+        }
+    }
+
+    start = now_us();
+    for (int it = 0; it < BENCH_ITERS / 10; it++) {
+        for (int b = 0; b < BENCH_BATCH; b++) {
+            ft_nn_compute_embedding(ws, inputs + b * FT_NN_INPUT_SIZE,
+                                    single + b * FT_NN_EMBEDDING_DIM);
+        }
+    }
+    single_us = (now_us() - start) / (BENCH_ITERS / 10) / BENCH_BATCH;
+
+    start = now_us();
+    for (int it = 0; it < BENCH_ITERS / 10; it++) {
+        ft_nn_compute_embeddings_batch(ws, inputs, BENCH_BATCH, batched);
+    }
+    batch_us = (now_us() - start) / (BENCH_ITERS / 10) / BENCH_BATCH;
+
+    for (int i = 0; i < BENCH_BATCH * FT_NN_EMBEDDING_DIM; i++) {
+        float d = fabsf(single[i] - batched[i]);
+        if (d > diff) diff = d;
+    }
+
+    printf("%-16s %8.1f us/image single, %8.1f us/image batched (%5.2fx)  max|d|=%.2g %s\n",
+           "batch of 11", single_us, batch_us, single_us / batch_us, diff,
+           diff <= FT_NN_EMBEDDING_TOLERANCE ? "ok" : "FAIL");
+}
+
+/* The four +-2 pixel TTA shifts, batched and from the input's conv1; embeddings must not change */
+static void bench_shifts(FtNNWorkspace *ws, const float *input)
+{
+    static const int shifts[4][2] = { { -2, 0 }, { 2, 0 }, { 0, -2 }, { 0, 2 } };
+    static float inputs[4 * FT_NN_INPUT_SIZE];
+    float batched[4 * FT_NN_EMBEDDING_DIM], shifted[4 * FT_NN_EMBEDDING_DIM];
+    double start, batch_us, shift_us;
+    float diff;
+
+    /* Edges clamped, as the TTA shifts are */
+    for (int b = 0; b < 4; b++) {
+        for (int y = 0; y < FT_NN_INPUT_HEIGHT; y++) {
+            for (int x = 0; x < FT_NN_INPUT_WIDTH; x++) {
+                int sx = x - shifts[b][0], sy = y - shifts[b][1];
+
+                sx = sx < 0 ? 0 : (sx >= FT_NN_INPUT_WIDTH ? FT_NN_INPUT_WIDTH - 1 : sx);
+                sy = sy < 0 ? 0 : (sy >= FT_NN_INPUT_HEIGHT ? FT_NN_INPUT_HEIGHT - 1 : sy);
+                inputs[b * FT_NN_INPUT_SIZE + y * FT_NN_INPUT_WIDTH + x] =
+                    input[sy * FT_NN_INPUT_WIDTH + sx];
+            }
+        }
+    }
+
+    start = now_us();
+    for (int it = 0; it < BENCH_ITERS / 10; it++) {
+        ft_nn_compute_embeddings_batch(ws, inputs, 4, batched);
+    }
+    batch_us = (now_us() - start) / (BENCH_ITERS / 10) / 4;
+
+    start = now_us();
+    for (int it = 0; it < BENCH_ITERS / 10; it++) {
+        ft_nn_compute_shifted_embeddings(ws, input, inputs, &shifts[0][0], 4, shifted);
+    }
+    shift_us = (now_us() - start) / (BENCH_ITERS / 10) / 4;
+
+    diff = max_abs_diff(shifted, batched, 4 * FT_NN_EMBEDDING_DIM);
+    printf("%-16s %8.1f us/image batched, %8.1f us/image shifted (%5.2fx)  max|d|=%.2g %s\n",
+           "4 shifts", batch_us, shift_us, batch_us / shift_us, diff,
+           diff == 0.0f ? "ok" : "FAIL");
+}
+
+static void report(const char *label, const double *layer_us, const double *base_us,
+                   const float *emb, const float *ref)
+{
+    float diff = max_abs_diff(emb, ref, FT_NN_EMBEDDING_DIM);
+
+    printf("%-16s", label);
+    for (int l = 0; l < BENCH_LAYERS; l++) {
+        printf(" %8.1f (%5.2fx)", layer_us[l], base_us[l] / layer_us[l]);
+    }
+    printf("  max|d|=%.2g %s\n", diff, diff <= FT_NN_EMBEDDING_TOLERANCE ? "ok" : "FAIL");
+}
+
+int main(int argc, char **argv)
+{
+    const FtNNKernels *const *sets = ft_nn_kernels_all();
+    static float input[FT_NN_INPUT_SIZE];
+    float ref[FT_NN_EMBEDDING_DIM], emb[FT_NN_EMBEDDING_DIM];
+    double base_us[BENCH_LAYERS], layer_us[BENCH_LAYERS];
+    char label[32];
+    int scalar, ret;
+    FtNNWorkspace *ws;
+
+    if (argc > 1 && (ret = ft_nn_load_model(argv[1])) != 0) {
+        fprintf(stderr, "cannot load %s: %s\n", argv[1], strerror(-ret));
+        return 1;
+    }
+    ws = ft_nn_workspace_new(BENCH_BATCH);
+    if (!ws) {
+        fprintf(stderr, "no weights: build with focaltech_nn_weights.h or pass a model file\n");
+        return 1;
+    }
+
+    make_probe(input);
+
+    for (scalar = 0; sets[scalar] != NULL; scalar++) {
+        if (strcmp(sets[scalar]->name, "scalar") == 0) break;
+    }
+
+    /* Baseline: scalar kernels, direct convolution */
+    ft_nn_kernels_force(sets[scalar]);
+    ft_nn_set_conv_algo(FT_NN_CONV_DIRECT);
+    ft_nn_compute_embedding(ws, input, ref);
+    bench_layers(ws, input, base_us);
+
+    printf("%-16s", "us/layer");
+    for (int l = 0; l < BENCH_LAYERS; l++) {
+        printf(" %17s", layer_names[l]);
+    }
+    printf("\n");
+    report("scalar/direct", base_us, base_us, ref, ref);
+
+    for (int s = 0; sets[s] != NULL; s++) {
+        if (!sets[s]->supported()) continue;
+
+        ft_nn_kernels_force(sets[s]);
+        for (int a = 0; a < 2; a++) {
+            ft_nn_set_conv_algo(algos[a]);
+            ft_nn_compute_embedding(ws, input, emb);
+            bench_layers(ws, input, layer_us);
+
+            snprintf(label, sizeof(label), "%s/%s", sets[s]->name, algo_names[a]);
+            report(label, layer_us, base_us, emb, ref);
+        }
+    }
+
+    ft_nn_kernels_force(NULL);
+    ft_nn_set_conv_algo(FT_NN_CONV_AUTO);
+    bench_batch(ws, input);
+    bench_shifts(ws, input);
+    printf("auto-selected kernels: %s\n", ft_nn_get_kernel_isa());
+
+    ft_nn_workspace_free(ws);
+    return 0;
+}
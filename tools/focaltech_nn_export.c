@@ -0,0 +1,145 @@
+/*
+ * FocalTech FT9362 NN model export
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * Writes the compiled-in weights as a model file for ft_nn_load_model():
+ * the plain tensors plus their GEMM and Winograd packings, each 64-byte
+ * aligned (see focaltech_nn_model.h). The file is then loaded back and
+ * every tensor compared against what was exported.
+ *
+ * Build (needs the generated focaltech_nn_weights.h next to the sources):
+ *   cc -O2 -Ishared tools/focaltech_nn_export.c shared/focaltech_nn_kernels.c \
+ *      -lm -lpthread -o ft-nn-export
+ *
+ * Usage:
+ *   ft-nn-export [focaltech0752.ftnn]
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+
+/* Pull in the layer tables, packing and model format */
+#include "focaltech_nn_infer.c"
+
+#ifndef FT_NN_BUILTIN_WEIGHTS
+#error "focaltech_nn_weights.h is needed to export a model"
+#endif
+
+/* Tensor t laid out as the file stores it; returns a malloc'd copy */
+static float *export_tensor(int t, const FtNNModelTensor *spec)
+{
+    float *data = (float *)aligned_alloc(FT_NN_MODEL_ALIGN,
+                                         (spec->size + FT_NN_MODEL_ALIGN - 1) /
+                                         FT_NN_MODEL_ALIGN * FT_NN_MODEL_ALIGN);
+
+    if (!data) return NULL;
+
+    if (t < 16 && t % 4 == 2) {
+        pack_weights(model.conv_weight[t / 4], spec->dims[0], spec->dims[1], data);
+    } else if (t < 16 && t % 4 == 3) {
+        pack_winograd(model.conv_weight[t / 4], spec->dims[1], spec->dims[2], data);
+    } else if (t >= 16 && (t - 16) % 3 == 2) {
+        pack_weights(model.fc_weight[(t - 16) / 3], spec->dims[0], spec->dims[1], data);
+    } else {
+        memcpy(data, *model_tensor_slot(t), spec->size);
+    }
+    return data;
+}
+
+/* Lay out the header for the tensors as model_tensor_spec() describes them */
+static void build_header(FtNNModelHeader *header)
+{
+    uint64_t offset = sizeof(*header);
+
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, FT_NN_MODEL_MAGIC, sizeof(header->magic));
+    header->version = FT_NN_MODEL_VERSION;
+    header->header_size = sizeof(*header);
+    header->dtype = FT_NN_MODEL_F32;
+    header->alignment = FT_NN_MODEL_ALIGN;
+    header->gemm_mr = GEMM_MR;
+    header->n_tensors = MODEL_TENSORS;
+
+    for (int t = 0; t < MODEL_TENSORS; t++) {
+        FtNNModelTensor *tensor = &header->tensors[t];
+
+        model_tensor_spec(t, tensor);
+        offset = (offset + FT_NN_MODEL_ALIGN - 1) / FT_NN_MODEL_ALIGN * FT_NN_MODEL_ALIGN;
+        tensor->offset = offset;
+        offset += tensor->size;
+    }
+    header->file_size = offset;
+}
+
+static int write_model(const char *path, FtNNModelHeader *header, float *const *tensors)
+{
+    unsigned char *file = (unsigned char *)calloc(1, header->file_size);
+    FILE *fp;
+    int ret = -1;
+
+    if (!file) return -1;
+
+    /* Assemble in memory so the checksum covers exactly what is written */
+    for (int t = 0; t < MODEL_TENSORS; t++) {
+        memcpy(file + header->tensors[t].offset, tensors[t], header->tensors[t].size);
+    }
+    memcpy(file, header, sizeof(*header));
+    header->checksum = model_checksum(file, header->file_size);
+    memcpy(file, header, sizeof(*header));
+
+    fp = fopen(path, "wb");
+    if (fp) {
+        size_t written = fwrite(file, 1, header->file_size, fp);
+        ret = fclose(fp) == 0 && written == header->file_size ? 0 : -1;
+    }
+    free(file);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out = argc > 1 ? argv[1] : "focaltech0752.ftnn";
+    FtNNModelHeader header;
+    float *tensors[MODEL_TENSORS];
+    int ret, status = 0;
+
+    build_header(&header);
+    for (int t = 0; t < MODEL_TENSORS; t++) {
+        tensors[t] = export_tensor(t, &header.tensors[t]);
+        if (!tensors[t]) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+    }
+
+    if (write_model(out, &header, tensors) != 0) {
+        fprintf(stderr, "cannot write %s\n", out);
+        return 1;
+    }
+    printf("wrote %s: %d tensors, %llu bytes, crc32 %08x\n", out, MODEL_TENSORS,
+           (unsigned long long)header.file_size, header.checksum);
+
+    ret = ft_nn_load_model(out);
+    if (ret != 0) {
+        fprintf(stderr, "cannot load %s back: %s\n", out, strerror(-ret));
+        return 1;
+    }
+
+    /* The mapping must now back every tensor and match what was exported */
+    for (int t = 0; t < MODEL_TENSORS; t++) {
+        const float *loaded = *model_tensor_slot(t);
+
+        if ((const unsigned char *)loaded != (const unsigned char *)model.map + header.tensors[t].offset ||
+            memcmp(loaded, tensors[t], header.tensors[t].size) != 0) {
+            fprintf(stderr, "%s differs after loading\n", header.tensors[t].name);
+            status = 1;
+        }
+        free(tensors[t]);
+    }
+    if (status == 0) {
+        printf("verified %s\n", out);
+    }
+    return status;
+}
@@ -0,0 +1,260 @@
+/*
+ * FocalTech FT9362 NN constant table generator
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * Writes focaltech_nn_tables.h, the constant tables of the matching code:
+ * the separable Gabor filter bank of the quality check, the Gaussian centre
+ * weight map, the source index of every pixel for each TTA rotation
+ * (nearest neighbour) and shift, and the shift offsets themselves. They are computed here with the same float
+ * expressions the matching code used at runtime, so the results do not
+ * change. Rerun after changing any of the parameters below.
+ *
+ * Build:
+ *   cc -O2 -Ishared tools/focaltech_nn_gentables.c -lm -o ft-nn-gentables
+ *
+ * Usage:
+ *   ft-nn-gentables [shared/focaltech_nn_tables.h]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "focaltech_nn_infer.h"
+
+#ifndef G_PI
+#define G_PI 3.14159265358979323846
+#endif
+
+#define GABOR_NUM_ORIENT  8
+#define GABOR_SIGMA       4.0f
+#define GABOR_WAVELENGTH  8.0f
+#define GABOR_KSIZE       17
+#define GABOR_NUM_PAIRS   (GABOR_NUM_ORIENT / 2 + 1)
+
+#define TTA_NUM_ROTATIONS 4
+#define TTA_NUM_SHIFTS    4
+#define TTA_NUM_REMAPS    (TTA_NUM_ROTATIONS + TTA_NUM_SHIFTS)
+
+static const float tta_rotations[TTA_NUM_ROTATIONS] = { -10.0f, -5.0f, 5.0f, 10.0f };
+static const int tta_shifts[TTA_NUM_SHIFTS][2] = { { -2, 0 }, { 2, 0 }, { 0, -2 }, { 0, 2 } };
+
+static float gabor_angles[GABOR_NUM_ORIENT];
+static float gabor_scale[GABOR_NUM_ORIENT];
+static float gabor_hcos[GABOR_NUM_PAIRS][GABOR_KSIZE];
+static float gabor_hsin[GABOR_NUM_PAIRS][GABOR_KSIZE];
+static float gabor_vcos[GABOR_NUM_PAIRS][GABOR_KSIZE];
+static float gabor_vsin[GABOR_NUM_PAIRS][GABOR_KSIZE];
+static float center_weight[FT_NN_INPUT_SIZE];
+static unsigned short remap[TTA_NUM_REMAPS][FT_NN_INPUT_SIZE];
+
+/*
+ * gabor_scale normalizes each kernel by the sum of its absolute values over
+ * the full 2-D window; the 1-D factors are the split of
+ *   g(x) g(y) cos(a x + b y) = g(x) cos(a x) g(y) cos(b y) - g(x) sin(a x) g(y) sin(b y)
+ */
+static void make_gabor(void)
+{
+    const int half = GABOR_KSIZE / 2;
+    const float freq = 1.0f / GABOR_WAVELENGTH;
+
+    for (int o = 0; o < GABOR_NUM_ORIENT; o++) {
+        float theta = (float)o * G_PI / GABOR_NUM_ORIENT;
+        float sum_abs = 0.0f;
+
+        gabor_angles[o] = theta;
+
+        for (int ky = -half; ky <= half; ky++) {
+            for (int kx = -half; kx <= half; kx++) {
+                float x_theta = kx * cosf(theta) + ky * sinf(theta);
+                float y_theta = -kx * sinf(theta) + ky * cosf(theta);
+                float gaussian = expf(-(x_theta * x_theta + y_theta * y_theta) /
+                                      (2 * GABOR_SIGMA * GABOR_SIGMA));
+                sum_abs += fabsf(gaussian * cosf(2 * G_PI * freq * x_theta));
+            }
+        }
+        gabor_scale[o] = 1.0f / (sum_abs + 1e-8f);
+
+        if (o >= GABOR_NUM_PAIRS) continue;
+
+        for (int i = 0; i < GABOR_KSIZE; i++) {
+            float k = (float)(i - half);
+            float envelope = expf(-(k * k) / (2 * GABOR_SIGMA * GABOR_SIGMA));
+            float a = 2 * G_PI * freq * cosf(theta) * k;
+            float b = 2 * G_PI * freq * sinf(theta) * k;
+
+            gabor_hcos[o][i] = envelope * cosf(a);
+            gabor_hsin[o][i] = envelope * sinf(a);
+            gabor_vcos[o][i] = envelope * cosf(b);
+            gabor_vsin[o][i] = envelope * sinf(b);
+        }
+    }
+}
+
+/* Gaussian around the image centre, sigma a third of the shorter side */
+static void make_center_weight(void)
+{
+    const int h = FT_NN_INPUT_HEIGHT, w = FT_NN_INPUT_WIDTH;
+    float cx = w / 2.0f, cy = h / 2.0f;
+    float sigma = (h < w ? h : w) / 3.0f;
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            float dx = x - cx, dy = y - cy;
+            center_weight[y * w + x] = expf(-(dx * dx + dy * dy) / (2 * sigma * sigma));
+        }
+    }
+}
+
+/* Rotation about the image centre, nearest neighbour, edges clamped */
+static void make_rotation_maps(void)
+{
+    const int h = FT_NN_INPUT_HEIGHT, w = FT_NN_INPUT_WIDTH;
+    float cx = w / 2.0f, cy = h / 2.0f;
+
+    for (int r = 0; r < TTA_NUM_ROTATIONS; r++) {
+        float angle_rad = tta_rotations[r] * (float)G_PI / 180.0f;
+        float cos_a = cosf(angle_rad), sin_a = sinf(angle_rad);
+
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                float dx = x - cx, dy = y - cy;
+                float sx = dx * cos_a + dy * sin_a + cx;
+                float sy = -dx * sin_a + dy * cos_a + cy;
+                int ix = (int)(sx + 0.5f), iy = (int)(sy + 0.5f);
+
+                ix = ix < 0 ? 0 : (ix >= w ? w - 1 : ix);
+                iy = iy < 0 ? 0 : (iy >= h ? h - 1 : iy);
+                remap[r][y * w + x] = (unsigned short)(iy * w + ix);
+            }
+        }
+    }
+}
+
+/* Translation by (dx, dy), edges clamped */
+static void make_shift_maps(void)
+{
+    const int h = FT_NN_INPUT_HEIGHT, w = FT_NN_INPUT_WIDTH;
+
+    for (int s = 0; s < TTA_NUM_SHIFTS; s++) {
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                int sx = x - tta_shifts[s][0], sy = y - tta_shifts[s][1];
+
+                sx = sx < 0 ? 0 : (sx >= w ? w - 1 : sx);
+                sy = sy < 0 ? 0 : (sy >= h ? h - 1 : sy);
+                remap[TTA_NUM_ROTATIONS + s][y * w + x] = (unsigned short)(sy * w + sx);
+            }
+        }
+    }
+}
+
+static void write_floats(FILE *fp, const float *values, int n, const char *indent)
+{
+    char literal[32];
+
+    for (int i = 0; i < n; i++) {
+        /* Round-trip precision; whole numbers need a point before the suffix */
+        snprintf(literal, sizeof(literal), "%.9g", values[i]);
+        if (!strpbrk(literal, ".e")) strcat(literal, ".0");
+
+        fprintf(fp, "%s%sf,%s", i % 6 == 0 ? indent : " ", literal,
+                i % 6 == 5 || i == n - 1 ? "\n" : "");
+    }
+}
+
+static void write_bank(FILE *fp, const char *name, float bank[][GABOR_KSIZE])
+{
+    fprintf(fp, "static const float %s[GABOR_NUM_PAIRS][GABOR_KSIZE] = {\n", name);
+    for (int p = 0; p < GABOR_NUM_PAIRS; p++) {
+        fprintf(fp, "  {\n");
+        write_floats(fp, bank[p], GABOR_KSIZE, "    ");
+        fprintf(fp, "  },\n");
+    }
+    fprintf(fp, "};\n\n");
+}
+
+static int write_header(const char *path)
+{
+    FILE *fp = fopen(path, "w");
+
+    if (!fp) return -1;
+
+    fprintf(fp, "/* Auto-generated by tools/focaltech_nn_gentables.c - DO NOT EDIT */\n");
+    fprintf(fp, "/* Gabor sigma %g, wavelength %g; TTA rotations", GABOR_SIGMA, GABOR_WAVELENGTH);
+    for (int r = 0; r < TTA_NUM_ROTATIONS; r++) {
+        fprintf(fp, " %g", tta_rotations[r]);
+    }
+    fprintf(fp, " degrees; TTA shifts");
+    for (int s = 0; s < TTA_NUM_SHIFTS; s++) {
+        fprintf(fp, " (%d, %d)", tta_shifts[s][0], tta_shifts[s][1]);
+    }
+    fprintf(fp, " */\n\n");
+    fprintf(fp, "#ifndef FOCALTECH_NN_TABLES_H\n#define FOCALTECH_NN_TABLES_H\n\n");
+    fprintf(fp, "#define GABOR_NUM_ORIENT  %d\n", GABOR_NUM_ORIENT);
+    fprintf(fp, "#define GABOR_KSIZE       %d\n", GABOR_KSIZE);
+    fprintf(fp, "#define GABOR_NUM_PAIRS   %d\n", GABOR_NUM_PAIRS);
+    fprintf(fp, "#define TTA_NUM_ROTATIONS %d\n", TTA_NUM_ROTATIONS);
+    fprintf(fp, "#define TTA_NUM_SHIFTS    %d\n", TTA_NUM_SHIFTS);
+    fprintf(fp, "#define TTA_NUM_REMAPS    %d\n\n", TTA_NUM_REMAPS);
+
+    fprintf(fp, "/* Orientation o is at o * pi / GABOR_NUM_ORIENT */\n");
+    fprintf(fp, "static const float gabor_angles[GABOR_NUM_ORIENT] = {\n");
+    write_floats(fp, gabor_angles, GABOR_NUM_ORIENT, "  ");
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "/* 1 / sum |kernel| of each full 2-D kernel */\n");
+    fprintf(fp, "static const float gabor_scale[GABOR_NUM_ORIENT] = {\n");
+    write_floats(fp, gabor_scale, GABOR_NUM_ORIENT, "  ");
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "/* Horizontal and vertical factors of orientation pair p and GABOR_NUM_ORIENT - p */\n");
+    write_bank(fp, "gabor_hcos", gabor_hcos);
+    write_bank(fp, "gabor_hsin", gabor_hsin);
+    write_bank(fp, "gabor_vcos", gabor_vcos);
+    write_bank(fp, "gabor_vsin", gabor_vsin);
+
+    fprintf(fp, "/* Quality centre weight of every pixel */\n");
+    fprintf(fp, "static const float quality_center_weight[FT_NN_INPUT_SIZE] = {\n");
+    write_floats(fp, center_weight, FT_NN_INPUT_SIZE, "  ");
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "/* (dx, dy) of each TTA shift */\n");
+    fprintf(fp, "static const int tta_shifts[TTA_NUM_SHIFTS][2] = {\n");
+    for (int s = 0; s < TTA_NUM_SHIFTS; s++) {
+        fprintf(fp, "  { %d, %d },\n", tta_shifts[s][0], tta_shifts[s][1]);
+    }
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "/* Source pixel of every output pixel for each TTA rotation, then each shift */\n");
+    fprintf(fp, "static const unsigned short tta_remap[TTA_NUM_REMAPS][FT_NN_INPUT_SIZE] = {\n");
+    for (int r = 0; r < TTA_NUM_REMAPS; r++) {
+        fprintf(fp, "  {\n");
+        for (int i = 0; i < FT_NN_INPUT_SIZE; i++) {
+            fprintf(fp, "%s%u,%s", i % 12 == 0 ? "    " : " ", remap[r][i],
+                    i % 12 == 11 || i == FT_NN_INPUT_SIZE - 1 ? "\n" : "");
+        }
+        fprintf(fp, "  },\n");
+    }
+    fprintf(fp, "};\n\n#endif /* FOCALTECH_NN_TABLES_H */\n");
+
+    return fclose(fp);
+}
+
+int main(int argc, char **argv)
+{
+    const char *out = argc > 1 ? argv[1] : "focaltech_nn_tables.h";
+
+    make_gabor();
+    make_center_weight();
+    make_rotation_maps();
+    make_shift_maps();
+
+    if (write_header(out) != 0) {
+        fprintf(stderr, "cannot write %s\n", out);
+        return 1;
+    }
+    printf("wrote %s\n", out);
+    return 0;
+}
@@ -0,0 +1,286 @@
+/*
+ * FocalTech FT9362 quality check benchmark
+ * Copyright (C) 2025-2026 Ivan Kovalev
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * Times the separable Gabor filter bank of ft_nn_check_quality() against
+ * direct 17x17 filtering with the same kernels, and reports how far the
+ * two disagree: the largest difference in gabor strength, the orientation
+ * map pixels that picked another angle, and the images whose strength
+ * lands on the other side of QUALITY_MIN_GABOR. The coarse first pass is
+ * timed too, with its largest relative error against the dense strength
+ * and the images where the tiered decision differs from the dense one.
+ * Probes are the 40x76 P5 PGMs written by the driver with FP_DEBUG_IMAGES
+ * set, or synthetic ridge patterns when no directory is given. No weights
+ * are needed.
+ *
+ * Build:
+ *   cc -O2 -Ishared $(pkg-config --cflags glib-2.0) tools/focaltech_nn_quality_bench.c \
+ *      shared/focaltech_nn_infer.c shared/focaltech_nn_kernels.c \
+ *      $(pkg-config --libs glib-2.0) -lm -lpthread -o ft-nn-quality-bench
+ *
+ * Usage:
+ *   ft-nn-quality-bench [pgm-dir]
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <dirent.h>
+#include <stdio.h>
+#include <time.h>
+
+/* Pull in the static quality helpers */
+#include "focaltech_nn_match.c"
+
+#define BENCH_MAX_PROBES 1024
+#define BENCH_SYNTHETIC 64
+#define BENCH_ITERS 20
+
+/* As in tools/focaltech_nn_gentables.c */
+#define GABOR_SIGMA 4.0f
+#define GABOR_WAVELENGTH 8.0f
+
+static FtNNEngine engine;
+static float orient_direct[FT_NN_INPUT_SIZE];
+static float gabor_kernels[GABOR_NUM_ORIENT][GABOR_KSIZE * GABOR_KSIZE];
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/* Read a binary PGM of the network input size, scaled to [0, 1] */
+static int read_pgm(const char *path, float *image)
+{
+    FILE *fp = fopen(path, "rb");
+    int width, height, maxval;
+    unsigned char pixels[FT_NN_INPUT_SIZE];
+
+    if (!fp) return -1;
+
+    if (fscanf(fp, "P5 %d %d %d", &width, &height, &maxval) != 3 ||
+        width != FT_NN_INPUT_WIDTH || height != FT_NN_INPUT_HEIGHT || maxval != 255 ||
+        fgetc(fp) == EOF ||
+        fread(pixels, 1, FT_NN_INPUT_SIZE, fp) != FT_NN_INPUT_SIZE) {
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+
+    for (int i = 0; i < FT_NN_INPUT_SIZE; i++) {
+        image[i] = pixels[i] / 255.0f;
+    }
+    return 0;
+}
+
+/* Load every readable *.pgm in dir; returns the number of probes */
+static int load_probes(const char *dir, float *probes)
+{
+    DIR *d = opendir(dir);
+    struct dirent *ent;
+    char path[4096];
+    int n = 0;
+
+    if (!d) return -1;
+
+    while ((ent = readdir(d)) != NULL && n < BENCH_MAX_PROBES) {
+        size_t len = strlen(ent->d_name);
+
+        if (len < 4 || strcmp(ent->d_name + len - 4, ".pgm") != 0) continue;
+
+        snprintf(path, sizeof(path), "%s/%s", dir, ent->d_name);
+        if (read_pgm(path, probes + n * FT_NN_INPUT_SIZE) == 0) {
+            n++;
+        } else {
+            fprintf(stderr, "skipping %s: not a %dx%d P5 image\n",
+                    path, FT_NN_INPUT_WIDTH, FT_NN_INPUT_HEIGHT);
+        }
+    }
+    closedir(d);
+    return n;
+}
+
+/* Ridge patterns over a range of angles and periods, some noise-only */
+static int make_probes(float *probes)
+{
+    unsigned int seed = 1;
+
+    for (int n = 0; n < BENCH_SYNTHETIC; n++) {
+        float angle = n * 0.37f, period = 6.0f + (n % 5);
+        float fx = 2 * G_PI / period * cosf(angle), fy = 2 * G_PI / period * sinf(angle);
+        float ridge = n % 8 == 7 ? 0.0f : 0.4f;
+
+        for (int y = 0; y < FT_NN_INPUT_HEIGHT; y++) {
+            for (int x = 0; x < FT_NN_INPUT_WIDTH; x++) {
+                float noise = (rand_r(&seed) / (float)RAND_MAX - 0.5f) * 0.2f;
+                probes[n * FT_NN_INPUT_SIZE + y * FT_NN_INPUT_WIDTH + x] =
+                    0.5f + ridge * sinf(fx * x + fy * y + 0.1f * sinf(0.2f * y)) + noise;
+            }
+        }
+    }
+    return BENCH_SYNTHETIC;
+}
+
+/* Zero-mean, unit-variance copy, as ft_nn_check_quality() filters it */
+static void normalize(const float *image, float *out)
+{
+    float mean = 0.0f, variance = 0.0f;
+
+    for (int i = 0; i < FT_NN_INPUT_SIZE; i++) mean += image[i];
+    mean /= FT_NN_INPUT_SIZE;
+    for (int i = 0; i < FT_NN_INPUT_SIZE; i++) variance += (image[i] - mean) * (image[i] - mean);
+    variance /= FT_NN_INPUT_SIZE;
+    for (int i = 0; i < FT_NN_INPUT_SIZE; i++) {
+        out[i] = (image[i] - mean) / (sqrtf(variance) + 1e-8f);
+    }
+}
+
+/* The full 2-D kernels, normalized by their sum of absolute values */
+static void make_kernels(void)
+{
+    const int half = GABOR_KSIZE / 2;
+    const float freq = 1.0f / GABOR_WAVELENGTH;
+
+    for (int o = 0; o < GABOR_NUM_ORIENT; o++) {
+        float theta = (float)o * G_PI / GABOR_NUM_ORIENT;
+        float sum_abs = 0.0f;
+
+        for (int ky = -half; ky <= half; ky++) {
+            for (int kx = -half; kx <= half; kx++) {
+                float x_theta = kx * cosf(theta) + ky * sinf(theta);
+                float y_theta = -kx * sinf(theta) + ky * cosf(theta);
+                float gaussian = expf(-(x_theta * x_theta + y_theta * y_theta) /
+                                      (2 * GABOR_SIGMA * GABOR_SIGMA));
+                float val = gaussian * cosf(2 * G_PI * freq * x_theta);
+
+                gabor_kernels[o][(ky + half) * GABOR_KSIZE + kx + half] = val;
+                sum_abs += fabsf(val);
+            }
+        }
+        for (int i = 0; i < GABOR_KSIZE * GABOR_KSIZE; i++) {
+            gabor_kernels[o][i] /= sum_abs + 1e-8f;
+        }
+    }
+}
+
+static float convolve_at(const float *img, int y, int x, const float *kernel)
+{
+    const int half = GABOR_KSIZE / 2;
+    float sum = 0.0f;
+
+    for (int ky = 0; ky < GABOR_KSIZE; ky++) {
+        for (int kx = 0; kx < GABOR_KSIZE; kx++) {
+            sum += img[(y + ky - half) * FT_NN_INPUT_WIDTH + x + kx - half] *
+                   kernel[ky * GABOR_KSIZE + kx];
+        }
+    }
+    return sum;
+}
+
+/* Reference: every 2-D kernel at every valid pixel */
+static float gabor_strength_direct(const float *img, float *orientation)
+{
+    const int half = GABOR_KSIZE / 2;
+    float sum = 0.0f;
+
+    for (int y = half; y < FT_NN_INPUT_HEIGHT - half; y++) {
+        for (int x = half; x < FT_NN_INPUT_WIDTH - half; x++) {
+            float max_resp = 0.0f;
+            int max_orient = 0;
+
+            for (int o = 0; o < GABOR_NUM_ORIENT; o++) {
+                float resp = fabsf(convolve_at(img, y, x, gabor_kernels[o]));
+                if (resp > max_resp) {
+                    max_resp = resp;
+                    max_orient = o;
+                }
+            }
+            sum += max_resp;
+            orientation[y * FT_NN_INPUT_WIDTH + x] = gabor_angles[max_orient];
+        }
+    }
+    return sum / (GABOR_VALID_H * GABOR_VALID_W);
+}
+
+int main(int argc, char **argv)
+{
+    static float probes[BENCH_MAX_PROBES * FT_NN_INPUT_SIZE];
+    static float norm[BENCH_MAX_PROBES * FT_NN_INPUT_SIZE];
+    float max_diff = 0.0f, max_coarse_err = 0.0f, sink = 0.0f;
+    long orient_diff = 0;
+    int n, flips = 0, coarse_flips = 0, refined = 0;
+    double t0, direct_us, separable_us, coarse_us;
+
+    n = argc > 1 ? load_probes(argv[1], probes) : make_probes(probes);
+    if (n <= 0) {
+        fprintf(stderr, "no probes in %s\n", argv[1]);
+        return 1;
+    }
+
+    make_kernels();
+    for (int i = 0; i < n; i++) {
+        normalize(probes + i * FT_NN_INPUT_SIZE, norm + i * FT_NN_INPUT_SIZE);
+    }
+
+    for (int i = 0; i < n; i++) {
+        const float *img = norm + i * FT_NN_INPUT_SIZE;
+        float direct = gabor_strength_direct(img, orient_direct);
+        float coarse, separable, tiered;
+
+        gabor_filter_bank_coarse(&engine, img);
+        coarse = tiered = gabor_strength(&engine, engine.orientation, QUALITY_COARSE_STEP);
+        gabor_filter_bank(&engine, img);
+        separable = gabor_strength(&engine, engine.orientation, 1);
+
+        if (coarse >= QUALITY_MIN_GABOR / QUALITY_GABOR_MARGIN &&
+            coarse <= QUALITY_MIN_GABOR * QUALITY_GABOR_MARGIN) {
+            tiered = separable;
+            refined++;
+        }
+        max_coarse_err = fmaxf(max_coarse_err, fabsf(coarse - separable) / fmaxf(separable, 1e-8f));
+        if ((tiered < QUALITY_MIN_GABOR) != (separable < QUALITY_MIN_GABOR)) coarse_flips++;
+
+        max_diff = fmaxf(max_diff, fabsf(direct - separable));
+        if ((direct < QUALITY_MIN_GABOR) != (separable < QUALITY_MIN_GABOR)) flips++;
+        for (int p = 0; p < FT_NN_INPUT_SIZE; p++) {
+            if (orient_direct[p] != engine.orientation[p]) orient_diff++;
+        }
+    }
+
+    t0 = now_us();
+    for (int it = 0; it < BENCH_ITERS; it++) {
+        for (int i = 0; i < n; i++) {
+            sink += gabor_strength_direct(norm + i * FT_NN_INPUT_SIZE, orient_direct);
+        }
+    }
+    direct_us = (now_us() - t0) / (BENCH_ITERS * n);
+
+    t0 = now_us();
+    for (int it = 0; it < BENCH_ITERS; it++) {
+        for (int i = 0; i < n; i++) {
+            gabor_filter_bank(&engine, norm + i * FT_NN_INPUT_SIZE);
+            sink += gabor_strength(&engine, engine.orientation, 1);
+        }
+    }
+    separable_us = (now_us() - t0) / (BENCH_ITERS * n);
+
+    t0 = now_us();
+    for (int it = 0; it < BENCH_ITERS; it++) {
+        for (int i = 0; i < n; i++) {
+            gabor_filter_bank_coarse(&engine, norm + i * FT_NN_INPUT_SIZE);
+            sink += gabor_strength(&engine, engine.orientation, QUALITY_COARSE_STEP);
+        }
+    }
+    coarse_us = (now_us() - t0) / (BENCH_ITERS * n);
+
+    printf("%d probes (checksum %.1f)\n", n, sink);
+    printf("gabor bank: direct %.1f us, separable %.1f us (%.1fx)\n",
+           direct_us, separable_us, direct_us / separable_us);
+    printf("max |d gabor|=%.2g, orientation pixels differing: %ld/%ld, threshold flips: %d\n",
+           max_diff, orient_diff, (long)n * GABOR_VALID_H * GABOR_VALID_W, flips);
+    printf("coarse step %d: %.1f us, max relative error %.2g, refined %d/%d, decision flips: %d\n",
+           QUALITY_COARSE_STEP, coarse_us, max_coarse_err, refined, n, coarse_flips);
+    return flips == 0 && coarse_flips == 0 ? 0 : 1;
+}